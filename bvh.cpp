@@ -0,0 +1,525 @@
+#include "bvh.h"
+
+#include <cstdio>
+#include <cfloat>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+namespace {
+
+	// every thread has its own deque: it pushes and pops at the back (depth first, so the data is still in cache), and idle threads
+	// steal from the front of someone else's, where the oldest and so biggest subtrees are
+	thread_local unsigned workerIndex = 0;
+
+	class StealingPool {
+	public:
+		// the thread that creates the pool is worker 0 and only works inside wait()
+		StealingPool(unsigned threads) : queues(threads) {
+			for (unsigned i = 1; i < threads; ++i)
+				workers.emplace_back([this, i] { workerIndex = i; work(); });
+		}
+		~StealingPool() {
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& worker : workers) worker.join();
+		}
+
+		void spawn(std::function<void()> task) {
+			{
+				Queue& own = queues[workerIndex];
+				std::lock_guard<std::mutex> lock(own.mutex);
+				own.tasks.push_back(std::move(task));
+			}
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				++queued;
+			}
+			wake.notify_one();
+		}
+
+		// runs tasks until pending is down to zero, so a thread that waits for others still does its share
+		void wait(const std::atomic<size_t>& pending) {
+			while (pending > 0)
+				if (!runOne())
+					std::this_thread::yield();
+		}
+
+	private:
+		bool runOne() {
+			std::function<void()> task;
+			const unsigned self = workerIndex, count = unsigned(queues.size());
+			for (unsigned k = 0; k < count && !task; ++k) {
+				Queue& queue = queues[(self + k) % count];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				if (queue.tasks.empty()) continue;
+				if (k == 0) {
+					task = std::move(queue.tasks.back());
+					queue.tasks.pop_back();
+				}
+				else {
+					task = std::move(queue.tasks.front());
+					queue.tasks.pop_front();
+				}
+			}
+			if (!task) return false;
+			--queued;
+			task();
+			return true;
+		}
+
+		void work() {
+			while (true) {
+				if (runOne()) continue;
+				std::unique_lock<std::mutex> lock(sleepMutex);
+				wake.wait(lock, [&] { return stopping || queued > 0; });
+				if (stopping) return;
+			}
+		}
+
+		struct Queue {
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+		std::vector<Queue> queues;
+		std::vector<std::thread> workers;
+		std::mutex sleepMutex;
+		std::condition_variable wake;
+		std::atomic<size_t> queued{ 0 };
+		bool stopping = false;
+	};
+
+	struct Box {
+		float low[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, high[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		void grow(const Box& b) {
+			for (int a = 0; a < 3; ++a) {
+				low[a] = b.low[a] < low[a] ? b.low[a] : low[a];
+				high[a] = b.high[a] > high[a] ? b.high[a] : high[a];
+			}
+		}
+		void grow(const float* p) {
+			for (int a = 0; a < 3; ++a) {
+				low[a] = p[a] < low[a] ? p[a] : low[a];
+				high[a] = p[a] > high[a] ? p[a] : high[a];
+			}
+		}
+		// half the surface area, which is all the ratios need; 0 for empty boxes
+		float area() const {
+			const float x = high[0] - low[0], y = high[1] - low[1], z = high[2] - low[2];
+			return x < 0.f || y < 0.f || z < 0.f ? 0.f : x * y + y * z + z * x;
+		}
+	};
+
+	struct Bin {
+		Box box;
+		uint32_t count = 0;
+	};
+
+	// a primitive's box and center travel with it through the partitions, so every pass over a node reads memory in order
+	struct Reference {
+		Box box;
+		float center[3];
+		int32_t primitive;
+	};
+
+	struct BuildNode {
+		Box box;
+		uint32_t begin = 0, count = 0;	// range of the references
+		int32_t left = -1;				// the first of two children; -1 for a leaf
+	};
+
+	// node ranges at least this big bin their primitives in parallel, in pieces of this size
+	const uint32_t parallelBinning = 1 << 16;
+	// smaller subtrees are built on the spot instead of spawned
+	const uint32_t smallestTask = 1 << 12;
+	const unsigned maxBins = 64;
+
+	struct Builder {
+		const BvhOptions& options;
+		std::vector<Reference> references;
+		std::vector<BuildNode> nodes;
+		std::atomic<size_t> nodeCount{ 1 };
+		std::atomic<size_t> pending{ 0 };
+		StealingPool pool;
+
+		Builder(const std::vector<float>& boxes, const BvhOptions& options, unsigned threads) :
+			options(options), pool(threads) {
+			const size_t count = boxes.size() / 6;
+			references.resize(count);
+			for (size_t i = 0; i < count; ++i) {
+				Reference& r = references[i];
+				memcpy(r.box.low, &boxes[i * 6], sizeof(r.box.low));
+				memcpy(r.box.high, &boxes[i * 6 + 3], sizeof(r.box.high));
+				for (int a = 0; a < 3; ++a)
+					r.center[a] = .5f * (r.box.low[a] + r.box.high[a]);
+				r.primitive = int32_t(i);
+			}
+			nodes.resize(count > 0 ? count * 2 - 1 : 1);
+		}
+
+		// runs work(begin, end) over pieces of [begin, end), in parallel if there's enough of it
+		template<typename Work>
+		void pieces(uint32_t begin, uint32_t end, const Work& work) {
+			if (end - begin < parallelBinning) return work(begin, end);
+			std::atomic<size_t> left{ 0 };
+			for (uint32_t start = begin; start < end; start += parallelBinning) {
+				++left;
+				const uint32_t stop = end - start > parallelBinning ? start + parallelBinning : end;
+				pool.spawn([&work, &left, start, stop] { work(start, stop); --left; });
+			}
+			pool.wait(left);
+		}
+
+		struct Split {
+			int axis = -1;			// -1: no plane separates the centers
+			float low = 0.f, scale = 0.f;	// a center goes to bin (c - low) * scale
+			uint32_t bin = 0;		// the last bin on the left
+			float cost = FLT_MAX;
+			Box left, right;
+			uint32_t leftCount = 0;
+		};
+
+		// the same arithmetic for binning and partitioning, so a primitive can't change sides in between
+		static uint32_t binOf(float center, float low, float scale, unsigned binCount) {
+			const uint32_t bin = uint32_t((center - low) * scale);
+			return bin < binCount ? bin : binCount - 1;
+		}
+
+		// the cheapest plane between the bins of any axis
+		Split findSplit(const BuildNode& node, const Box& centerBox, unsigned binCount) {
+			float scale[3];
+			for (int a = 0; a < 3; ++a) {
+				const float extent = centerBox.high[a] - centerBox.low[a];
+				scale[a] = extent > 0.f ? float(binCount) * (1.f - 1e-6f) / extent : 0.f;
+			}
+
+			// small nodes are most of the tree, so they bin into scratch that's kept per thread (they don't wait on other tasks,
+			// which could reuse it); the big ones bin pieces in parallel and merge
+			thread_local std::vector<Bin> scratch;
+			std::vector<Bin> merged;
+			std::vector<Bin>& bins = node.count < parallelBinning ? scratch : merged;
+			bins.assign(binCount * 3, Bin());
+			const auto binRange = [&](uint32_t begin, uint32_t end, Bin* out) {
+				for (uint32_t i = begin; i < end; ++i) {
+					const Reference& r = references[i];
+					for (int a = 0; a < 3; ++a) {
+						Bin& bin = out[a * binCount + binOf(r.center[a], centerBox.low[a], scale[a], binCount)];
+						bin.box.grow(r.box);
+						++bin.count;
+					}
+				}
+			};
+			if (node.count < parallelBinning)
+				binRange(node.begin, node.begin + node.count, bins.data());
+			else {
+				std::mutex merge;
+				pieces(node.begin, node.begin + node.count, [&](uint32_t begin, uint32_t end) {
+					std::vector<Bin> local(binCount * 3);
+					binRange(begin, end, local.data());
+					std::lock_guard<std::mutex> lock(merge);
+					for (unsigned b = 0; b < binCount * 3; ++b) {
+						merged[b].box.grow(local[b].box);
+						merged[b].count += local[b].count;
+					}
+				});
+			}
+
+			// a sweep from the right for the right side of every plane, then one from the left that prices them
+			const uint32_t minimum = options.minLeafSize > 1 ? options.minLeafSize : 1;
+			Split best;
+			const float area = node.box.area();
+			thread_local std::vector<Box> rightBoxes;
+			rightBoxes.resize(binCount);
+			for (int a = 0; a < 3; ++a) {
+				if (scale[a] == 0.f) continue;
+				const Bin* axisBins = &bins[a * binCount];
+				Box right;
+				for (unsigned b = binCount - 1; b > 0; --b) {
+					right.grow(axisBins[b].box);
+					rightBoxes[b] = right;
+				}
+				Box left;
+				uint32_t leftCount = 0;
+				for (unsigned b = 0; b + 1 < binCount; ++b) {
+					left.grow(axisBins[b].box);
+					leftCount += axisBins[b].count;
+					const uint32_t rightCount = node.count - leftCount;
+					if (leftCount < minimum || rightCount < minimum) continue;
+					const float weighted = left.area() * float(leftCount) + rightBoxes[b + 1].area() * float(rightCount);
+					const float cost = options.traversalCost + options.intersectionCost * (area > 0.f ? weighted / area : float(node.count));
+					if (cost < best.cost) {
+						best.axis = a;
+						best.low = centerBox.low[a];
+						best.scale = scale[a];
+						best.bin = b;
+						best.cost = cost;
+						best.left = left;
+						best.right = rightBoxes[b + 1];
+						best.leftCount = leftCount;
+					}
+				}
+			}
+			return best;
+		}
+
+		// makes nodes[index] a leaf or splits it, and goes on with the children: the right one as a task of its own if it's big
+		// enough, the left one right here
+		void build(uint32_t index) {
+			while (true) {
+				BuildNode& node = nodes[index];
+				if (node.count <= 1) return;
+
+				Box centerBox;
+				std::mutex merge;
+				pieces(node.begin, node.begin + node.count, [&](uint32_t begin, uint32_t end) {
+					Box local;
+					for (uint32_t i = begin; i < end; ++i)
+						local.grow(references[i].center);
+					std::lock_guard<std::mutex> lock(merge);
+					centerBox.grow(local);
+				});
+
+				// a few primitives don't need more bins than there are of them
+				unsigned binCount = options.binCount < 2 ? 2 : options.binCount > maxBins ? maxBins : options.binCount;
+				binCount = binCount > node.count ? node.count : binCount;
+				Split split = findSplit(node, centerBox, binCount);
+				const float leafCost = options.intersectionCost * float(node.count);
+				if (node.count <= options.maxLeafSize && (split.axis < 0 || split.cost >= leafCost))
+					return;
+
+				Reference* first = references.data() + node.begin;
+				if (split.axis >= 0)
+					std::partition(first, first + node.count, [&](const Reference& r) {
+						return binOf(r.center[split.axis], split.low, split.scale, binCount) <= split.bin;
+					});
+				else {
+					// no plane separates the centers (or none leaves minLeafSize on both sides), so the range is just halved
+					split.leftCount = node.count / 2;
+					split.left = split.right = Box();
+					for (uint32_t i = 0; i < node.count; ++i)
+						(i < split.leftCount ? split.left : split.right).grow(first[i].box);
+				}
+
+				const uint32_t left = uint32_t(nodeCount.fetch_add(2));
+				node.left = int32_t(left);
+				nodes[left] = { split.left, node.begin, split.leftCount };
+				nodes[left + 1] = { split.right, node.begin + split.leftCount, node.count - split.leftCount };
+				if (nodes[left + 1].count >= smallestTask) {
+					++pending;
+					pool.spawn([this, left] { build(left + 1); --pending; });
+				}
+				else
+					build(left + 1);
+				index = left;
+			}
+		}
+	};
+}
+
+FlatBvh buildBvh(const std::vector<float>& boxes, const BvhOptions& options) {
+	const auto start = std::chrono::high_resolution_clock::now();
+	const size_t count = boxes.size() / 6;
+	if (count == 0 || count > size_t(INT32_MAX) / 2) {
+		printf("buildBvh: can't build over %zu primitives\n", count);
+		return FlatBvh();
+	}
+	unsigned threads = options.threads > 0 ? options.threads : std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+
+	Builder builder(boxes, options, threads);
+	BuildNode& root = builder.nodes[0];
+	root.count = uint32_t(count);
+	std::mutex merge;
+	builder.pieces(0, uint32_t(count), [&](uint32_t begin, uint32_t end) {
+		Box local;
+		for (uint32_t i = begin; i < end; ++i)
+			local.grow(builder.references[i].box);
+		std::lock_guard<std::mutex> lock(merge);
+		root.box.grow(local);
+	});
+	builder.build(0);
+	builder.pool.wait(builder.pending);
+
+	// breadth first: a node's children get the next two free numbers when it's reached
+	const size_t nodeCount = builder.nodeCount;
+	FlatBvh result;
+	result.extents.resize(nodeCount * 6);
+	result.children.resize(nodeCount + 1);
+	result.children[0] = int32_t(nodeCount);
+	result.sizes.assign(nodeCount, 0);
+	result.parents.assign(nodeCount, -1);
+	result.leaves.resize(count);
+	std::vector<uint32_t> source(nodeCount);
+	source[0] = 0;
+	size_t next = 1;
+	for (size_t flat = 0; flat < nodeCount; ++flat) {
+		const BuildNode& node = builder.nodes[source[flat]];
+		for (int a = 0; a < 3; ++a) {
+			result.extents[flat * 6 + a * 2] = sortable(node.box.low[a]);
+			result.extents[flat * 6 + a * 2 + 1] = sortable(node.box.high[a]);
+		}
+		if (node.left < 0) {
+			result.sizes[flat] = int32_t(node.count);
+			result.children[flat + 1] = int32_t(node.begin);
+			for (uint32_t i = node.begin; i < node.begin + node.count; ++i)
+				result.leaves[builder.references[i].primitive] = int32_t(flat);
+		}
+		else {
+			result.children[flat + 1] = int32_t(next);
+			source[next] = uint32_t(node.left);
+			source[next + 1] = uint32_t(node.left + 1);
+			result.parents[next] = result.parents[next + 1] = int32_t(flat);
+			next += 2;
+		}
+	}
+	result.primitives.resize(count);
+	for (size_t i = 0; i < count; ++i)
+		result.primitives[i] = builder.references[i].primitive;
+	result.buildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	result.sahCost = sahCost(result, options);
+	return result;
+}
+
+FlatBvh buildPointBvh(const float* positions, const float* extents, size_t count, const BvhOptions& options) {
+	std::vector<float> boxes(count * 6);
+	for (size_t i = 0; i < count; ++i)
+		for (int a = 0; a < 3; ++a) {
+			const float p = positions[i + a * count], e = extents ? extents[i + a * count] : 0.f;
+			boxes[i * 6 + a] = p - e;
+			boxes[i * 6 + 3 + a] = p + e;
+		}
+	return buildBvh(boxes, options);
+}
+
+FlatBvh buildTriangleBvh(const std::vector<float>& positions, const std::vector<uint32_t>& indices, const BvhOptions& options) {
+	std::vector<float> boxes(indices.size() / 3 * 6);
+	for (size_t t = 0; t < indices.size() / 3; ++t) {
+		Box box;
+		for (int c = 0; c < 3; ++c)
+			box.grow(&positions[size_t(indices[t * 3 + c]) * 4]);
+		memcpy(&boxes[t * 6], box.low, sizeof(box.low));
+		memcpy(&boxes[t * 6 + 3], box.high, sizeof(box.high));
+	}
+	return buildBvh(boxes, options);
+}
+
+float sahCost(const FlatBvh& bvh, const BvhOptions& options) {
+	const size_t nodeCount = bvh.nodeCount();
+	if (nodeCount == 0) return 0.f;
+	std::vector<bool> inner(nodeCount, false);
+	for (size_t i = 1; i < nodeCount; ++i)
+		if (bvh.parents[i] >= 0) inner[bvh.parents[i]] = true;
+
+	const auto area = [&](size_t node) {
+		Box box;
+		for (int a = 0; a < 3; ++a) {
+			box.low[a] = unsortable(bvh.extents[node * 6 + a * 2]);
+			box.high[a] = unsortable(bvh.extents[node * 6 + a * 2 + 1]);
+		}
+		return double(box.area());
+	};
+	const double rootArea = area(0);
+	double cost = 0.;
+	for (size_t i = 0; i < nodeCount; ++i) {
+		if (i > 0 && bvh.parents[i] < 0) continue;
+		const double ratio = rootArea > 0. ? area(i) / rootArea : 1.;
+		if (inner[i])
+			cost += options.traversalCost * ratio;
+		else if (bvh.sizes[i] > 0)
+			cost += options.intersectionCost * bvh.sizes[i] * ratio;
+	}
+	return float(cost);
+}
+
+Neighbours findNeighbours(const FlatBvh& bvh, const float* positions, size_t pointCount, const float* queries, size_t queryCount,
+	unsigned k, float radius, bool countAll, unsigned threads) {
+	Neighbours result;
+	if (k == 0 || bvh.nodeCount() == 0) {
+		printf("findNeighbours: can't look for %u neighbours in %zu nodes\n", k, bvh.nodeCount());
+		return result;
+	}
+	result.indices.assign(queryCount * k, -1);
+	result.distances.assign(queryCount * k, INFINITY);
+	result.counts.assign(queryCount, 0);
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+
+	const float range = radius * radius;
+	const auto boxDistance = [&](int32_t node, const float* q) {
+		float sum = 0.f;
+		for (int a = 0; a < 3; ++a) {
+			const float low = unsortable(bvh.extents[node * 6 + a * 2]) - q[a], high = q[a] - unsortable(bvh.extents[node * 6 + a * 2 + 1]);
+			const float d = low > high ? low : high;
+			sum += d > 0.f ? d * d : 0.f;
+		}
+		return sum;
+	};
+	const auto run = [&](size_t begin, size_t end) {
+		std::vector<std::pair<float, int32_t>> stack;
+		std::vector<float> best(k);
+		for (size_t i = begin; i < end; ++i) {
+			const float q[3] = { queries[i], queries[i + queryCount], queries[i + 2 * queryCount] };
+			int32_t* indices = &result.indices[i * k];
+			float* distances = best.data();
+			best.assign(k, INFINITY);
+			uint32_t found = 0;
+			float bound = range;
+			stack.assign(1, { boxDistance(0, q), 0 });
+			while (!stack.empty()) {
+				const std::pair<float, int32_t> entry = stack.back();
+				stack.pop_back();
+				if (entry.first > bound) continue;
+				const int32_t node = entry.second;
+				if (bvh.sizes[node] == 0) {
+					// the far child goes under the near one, so the near one comes off first
+					const int32_t first = bvh.children[node + 1];
+					const float d0 = boxDistance(first, q), d1 = boxDistance(first + 1, q);
+					if (d1 < d0) stack.insert(stack.end(), { { d0, first }, { d1, first + 1 } });
+					else stack.insert(stack.end(), { { d1, first + 1 }, { d0, first } });
+					continue;
+				}
+				const int32_t start = bvh.children[node + 1];
+				for (int32_t j = start; j < start + bvh.sizes[node]; ++j) {
+					const int32_t p = bvh.primitives[j];
+					float d2 = 0.f;
+					for (int a = 0; a < 3; ++a) {
+						const float d = positions[p + a * pointCount] - q[a];
+						d2 += d * d;
+					}
+					if (d2 > range) continue;
+					if (countAll) ++found;
+					if (d2 >= distances[k - 1]) continue;
+					if (!countAll && found < k) ++found;
+					unsigned slot = k - 1;
+					for (; slot > 0 && distances[slot - 1] > d2; --slot) {
+						distances[slot] = distances[slot - 1];
+						indices[slot] = indices[slot - 1];
+					}
+					distances[slot] = d2;
+					indices[slot] = p;
+					if (!countAll)
+						bound = distances[k - 1] < range ? distances[k - 1] : range;
+				}
+			}
+			for (unsigned j = 0; j < k; ++j)
+				result.distances[i * k + j] = indices[j] >= 0 ? std::sqrt(distances[j]) : INFINITY;
+			result.counts[i] = found;
+		}
+	};
+	std::vector<std::thread> workers;
+	const size_t piece = (queryCount + threads - 1) / threads;
+	for (unsigned t = 1; t < threads && t * piece < queryCount; ++t)
+		workers.emplace_back(run, t * piece, (t + 1) * piece < queryCount ? (t + 1) * piece : queryCount);
+	run(0, piece < queryCount ? piece : queryCount);
+	for (auto& w : workers) w.join();
+	return result;
+}
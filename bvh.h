@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+// bounding volume hierarchies built on the CPU and flattened into the buffers naive_bvh's shaders use (buildExtents, buildIndices,
+// buildSizes and buildParents per node, indices and nodes per primitive), so a CPU tree is drawn and traversed by the same GLSL as
+// one from the GPU builder, and the two can be held against each other. plain CPU work, no GL.
+
+// floats as uints that order the same way, so that the GPU builder can atomicMin/atomicMax bounds; shaders undo it with unsortable()
+inline uint32_t sortable(float x) {
+	uint32_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+	return bits ^ (uint32_t(-int32_t(bits >> 31)) | 0x80000000u);
+}
+
+inline float unsortable(uint32_t bits) {
+	bits ^= ((bits >> 31) - 1) | 0x80000000u;
+	float x;
+	memcpy(&x, &bits, sizeof(x));
+	return x;
+}
+
+// node 0 is the root and the two children of a node are adjacent. buildBvh() numbers nodes breadth first, so the top levels come first
+struct FlatBvh {
+	std::vector<uint32_t> extents;		// buildExtents: per node and axis, (min, max) through sortable()
+	std::vector<int32_t> children;		// buildIndices: the node count, then per node its first child, or for a leaf where its primitives start
+	std::vector<int32_t> sizes;			// buildSizes: primitives in a leaf, 0 for inner nodes
+	std::vector<int32_t> parents;		// buildParents: -1 for the root
+	std::vector<int32_t> primitives;	// indices: primitive ids, the ones of each leaf back to back
+	std::vector<int32_t> leaves;		// nodes: the leaf each primitive ended up in
+	double buildMilliseconds = 0.;		// of buildBvh() itself
+	float sahCost = 0.f;				// see sahCost()
+
+	size_t nodeCount() const { return parents.size(); }
+};
+
+struct BvhOptions {
+	unsigned maxLeafSize = 16;		// bigger nodes are always split, smaller ones only when the SAH says it pays off
+	unsigned minLeafSize = 2;		// no plane leaves fewer on either side; 2 keeps the tree within the N - 1 nodes naive_bvh has room for
+	unsigned binCount = 16;			// per axis, for binCount - 1 candidate planes; at most 64
+	float traversalCost = 1.f;		// of visiting an inner node, relative to
+	float intersectionCost = 1.f;	// testing one primitive
+	unsigned threads = 0;			// 0: one per core
+};
+
+// binned SAH (Wald's "On fast construction of SAH-based bounding volume hierarchies"): every node tries binCount - 1 planes along
+// each axis through the primitive centers and takes the cheapest. subtrees are tasks on a work-stealing pool, and the nodes near the
+// root, which are too few to keep the threads busy, bin their primitives in parallel instead.
+// primitive i is the box from boxes[6i..6i+2] to boxes[6i+3..6i+5]
+FlatBvh buildBvh(const std::vector<float>& boxes, const BvhOptions& options = BvhOptions());
+
+// points laid out like naive_bvh's: all x, then all y, then all z. extents are half sizes in the same layout (null for none)
+FlatBvh buildPointBvh(const float* positions, const float* extents, size_t count, const BvhOptions& options = BvhOptions());
+// triangles like IndexedTriangles (mesh_optimizer.h) holds them: vec4 positions and 3 indices per triangle
+FlatBvh buildTriangleBvh(const std::vector<float>& positions, const std::vector<uint32_t>& indices, const BvhOptions& options = BvhOptions());
+
+// the surface area heuristic: the expected cost of tracing a ray that hits the root, in the options' units; lower is better.
+// only extents, sizes and parents are read (inner nodes are the ones some node names as its parent, and nodes other than the root
+// without a parent are unused), so it works just as well on a tree read back from the GPU builder
+float sahCost(const FlatBvh& bvh, const BvhOptions& options = BvhOptions());
+
+// neighbour lists, k per query: point indices nearest first (-1 past the last one found), their distances (infinity past it), and
+// how many were found per query
+struct Neighbours {
+	std::vector<int32_t> indices;
+	std::vector<float> distances;
+	std::vector<uint32_t> counts;
+};
+
+// the k nearest points no farther than radius from each query, by a nearest-first traversal of a tree from buildPointBvh(); with
+// countAll, counts gets every point within radius rather than only the ones kept. queries are laid out like the points. this is the
+// CPU reference for NeighbourQueries (gpu_bvh.h), split over threads by query (0: one per core)
+Neighbours findNeighbours(const FlatBvh& bvh, const float* positions, size_t pointCount, const float* queries, size_t queryCount,
+	unsigned k, float radius = INFINITY, bool countAll = false, unsigned threads = 0);
@@ -134,41 +134,6 @@ void bindOutputDepthRenderbuffer(GLuint renderbuffer) {
 	//printf("renderbuffer %s bound to fragment output %d!\n", name.c_str(), location);
 }
 
-#include <gdiplus.h>
-#pragma comment(lib, "gdiplus.lib")
-#include <locale>
-#include <codecvt>
-
-Texture<GL_TEXTURE_2D> loadImage(const std::wstring& path) {
-	using namespace Gdiplus;
-	ULONG_PTR token;
-	GdiplusStartup(&token, &GdiplusStartupInput(), nullptr);
-
-	Texture<GL_TEXTURE_2D> result;
-	// new scope so RAII objects are released before gdi+ shutdown
-	{
-		Image image(path.c_str());
-		image.RotateFlip(RotateNoneFlipY);
-		const Rect r(0, 0, image.GetWidth(), image.GetHeight());
-		BitmapData data;
-		((Bitmap*)&image)->LockBits(&r, ImageLockModeRead, PixelFormat24bppRGB, &data);
-
-		glBindTexture(GL_TEXTURE_2D, result);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8, image.GetWidth(), image.GetHeight(), 0, GL_BGR, GL_UNSIGNED_BYTE, data.Scan0);
-		glGenerateMipmap(GL_TEXTURE_2D);
-
-		((Bitmap*)&image)->UnlockBits(&data);
-	}
-	GdiplusShutdown(token);
-	return result;
-}
-
-Texture<GL_TEXTURE_2D> loadImage(const std::string& path) {
-	wchar_t str[4096];
-	MultiByteToWideChar(CP_UTF8, MB_PRECOMPOSED, path.c_str(), -1, str, 4096);
-	return loadImage(std::wstring(str));
-}
-
 // all uniform functions using the name directly instead of the getuniformlocation trouble
 #define uniform_copy(postfix, postfix_v, type)\
 void glUniform1##postfix(const std::string& name, type value) { glUniform1##postfix(glGetUniformLocation(currentProgram(), name.c_str()), value); }\
@@ -1,14 +1,10 @@
 #pragma once
 
-#include <Windows.h>
-
 #include <vector>
 #include <string>
 #include <string_view>
 #include <filesystem>
 
-#include <gl/gl.h>
-#include "loadgl/glext.h"
 #include "loadgl/loadgl46.h"
 
 #include "shaderprintf.h"
@@ -128,12 +124,9 @@ protected:
 	void reloadIfRequired();
 
 	void addPath(std::string_view path);
-	void destroy() { glDeleteProgram(program); program = 0; }
+	void destroy() { releasePrintfProgram(program); glDeleteProgram(program); program = 0; }
 };
 
-Texture<GL_TEXTURE_2D> loadImage(const std::string& path);
-Texture<GL_TEXTURE_2D> loadImage(const std::wstring& path);
-
 // todo: stringviews?
 #define uniform_copy(postfix, postfix_v, type)\
 void glUniform1##postfix(const std::string& name, type value);\
@@ -1,11 +1,7 @@
 #pragma once
 
-#include <Windows.h>
-
 #include <string>
 
-#include <gl/gl.h>
-#include "loadgl/glext.h"
 #include "loadgl/loadgl46.h"
 
 // GPU timing object
@@ -0,0 +1,322 @@
+#include "gpu_bvh.h"
+
+#include <cstdio>
+#include <utility>
+
+FlatBvh GpuBvh::download() const {
+	FlatBvh result;
+	if (nodeCapacity == 0) return result;
+	GLint nodeCount = 0;
+	glGetNamedBufferSubData(buildIndices, 0, sizeof(GLint), &nodeCount);
+	if (nodeCount < 1 || nodeCount > nodeCapacity) {
+		printf("GpuBvh::download: bad node count %d\n", nodeCount);
+		return result;
+	}
+	result.extents.resize(size_t(nodeCount) * 6);
+	result.children.resize(size_t(nodeCount) + 1);
+	result.sizes.resize(nodeCount);
+	result.parents.resize(nodeCount);
+	result.primitives.resize(pointCount);
+	result.leaves.resize(pointCount);
+	glGetNamedBufferSubData(buildExtents, 0, sizeof(uint32_t) * result.extents.size(), result.extents.data());
+	glGetNamedBufferSubData(buildIndices, 0, sizeof(int32_t) * result.children.size(), result.children.data());
+	glGetNamedBufferSubData(buildSizes, 0, sizeof(int32_t) * result.sizes.size(), result.sizes.data());
+	glGetNamedBufferSubData(buildParents, 0, sizeof(int32_t) * result.parents.size(), result.parents.data());
+	glGetNamedBufferSubData(indices, 0, sizeof(int32_t) * result.primitives.size(), result.primitives.data());
+	glGetNamedBufferSubData(nodes, 0, sizeof(int32_t) * result.leaves.size(), result.leaves.data());
+	return result;
+}
+
+LinearBvhBuilder::LinearBvhBuilder() :
+	morton(createProgram("shaders/lbvhMorton.glsl")),
+	radixSort(createProgram("shaders/radixSort.glsl")),
+	scan(createProgram("shaders/scan.glsl")),
+	hierarchy(createProgram("shaders/lbvhHierarchy.glsl")),
+	fit(createProgram("shaders/lbvhFit.glsl")) {
+	glNamedBufferStorage(box, sizeof(GLuint) * 6, nullptr, 0);
+	glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 0, &maxGroups);
+}
+
+void LinearBvhBuilder::prefixSum(GLuint data, GLuint count, size_t level) {
+	const GLuint blocks = (count + 255) / 256;
+	glUseProgram(scan);
+	glUniform1ui("count", count);
+	glUniform1i("addSums", false);
+	bindBuffer("scanData", data);
+	bindBuffer("scanSums", scanSums[level]);
+	glDispatchCompute(blocks, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	if (blocks == 1) return;
+
+	prefixSum(scanSums[level], blocks, level + 1);
+	glUseProgram(scan);
+	glUniform1ui("count", count);
+	glUniform1i("addSums", true);
+	bindBuffer("scanData", data);
+	bindBuffer("scanSums", scanSums[level]);
+	glDispatchCompute(blocks, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void LinearBvhBuilder::build(GpuBvh& bvh, GLuint points, GLuint extents, GLsizei count, bool wideCodes) {
+	// all the passes take 1024 points per group, so the group count limit (65535 at least) goes to 64M points
+	const GLuint groups = (GLuint(count) + 1023) / 1024;
+	if (count < 1 || groups > GLuint(maxGroups)) {
+		printf("LinearBvhBuilder::build: can't build over %d points\n", count);
+		return;
+	}
+
+	// immutable storage can't grow, so start over
+	if (count > capacity) {
+		for (Buffer& b : keys) {
+			b = Buffer();
+			glNamedBufferStorage(b, sizeof(GLuint) * 2 * count, nullptr, 0);
+		}
+		values = Buffer();
+		glNamedBufferStorage(values, sizeof(GLuint) * count, nullptr, 0);
+		links = Buffer();
+		glNamedBufferStorage(links, sizeof(GLint) * 2 * (2 * count - 1), nullptr, 0);
+		arrivals = Buffer();
+		glNamedBufferStorage(arrivals, sizeof(GLuint) * count, nullptr, 0);
+		digitCounts = Buffer();
+		glNamedBufferStorage(digitCounts, sizeof(GLuint) * 16 * groups, nullptr, 0);
+		scanSums.clear();
+		for (GLuint blocks = (16 * groups + 255) / 256; ; blocks = (blocks + 255) / 256) {
+			scanSums.emplace_back();
+			glNamedBufferStorage(scanSums.back(), sizeof(GLuint) * blocks, nullptr, 0);
+			if (blocks == 1) break;
+		}
+		capacity = count;
+	}
+	if (count > bvh.pointCapacity || 2 * count - 1 > bvh.nodeCapacity) {
+		bvh = GpuBvh();
+		glNamedBufferStorage(bvh.buildExtents, sizeof(GLuint) * 6 * (2 * count - 1), nullptr, 0);
+		glNamedBufferStorage(bvh.buildIndices, sizeof(GLint) * 2 * count, nullptr, 0);
+		glNamedBufferStorage(bvh.buildSizes, sizeof(GLint) * (2 * count - 1), nullptr, 0);
+		glNamedBufferStorage(bvh.buildParents, sizeof(GLint) * (2 * count - 1), nullptr, 0);
+		glNamedBufferStorage(bvh.indices, sizeof(GLint) * count, nullptr, 0);
+		glNamedBufferStorage(bvh.nodes, sizeof(GLint) * count, nullptr, 0);
+		bvh.pointCapacity = count;
+		bvh.nodeCapacity = 2 * count - 1;
+	}
+	bvh.pointCount = count;
+
+	// the box first, then the codes in it; the sort's values start out as (and end up in) the tree's point indices
+	const GLuint emptyBox[2] = { ~0u, 0u };
+	glClearNamedBufferData(box, GL_RG32UI, GL_RG_INTEGER, GL_UNSIGNED_INT, emptyBox);
+	glUseProgram(morton);
+	glUniform1ui("count", GLuint(count));
+	glUniform1i("wideCodes", wideCodes);
+	bindBuffer("points", points);
+	bindBuffer("lbvhBox", box);
+	bindBuffer("keysOut", keys[0]);
+	bindBuffer("valuesOut", bvh.indices);
+	for (int bounds = 1; bounds >= 0; --bounds) {
+		glUniform1i("bounds", bounds);
+		glDispatchCompute(groups, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	}
+
+	// an even number of passes, so the sorted keys and values are back where they started
+	const GLuint sortValues[2] = { bvh.indices, values };
+	const GLuint passes = wideCodes ? 16 : 8;
+	for (GLuint pass = 0; pass < passes; ++pass) {
+		const GLuint from = pass % 2, to = 1 - from;
+		glUseProgram(radixSort);
+		glUniform1ui("count", GLuint(count));
+		glUniform1ui("pass", pass);
+		glUniform1i("scatter", false);
+		bindBuffer("keysIn", keys[from]);
+		bindBuffer("valuesIn", sortValues[from]);
+		bindBuffer("keysOut", keys[to]);
+		bindBuffer("valuesOut", sortValues[to]);
+		bindBuffer("digitCounts", digitCounts);
+		glDispatchCompute(groups, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+		prefixSum(digitCounts, 16 * groups);
+
+		glUseProgram(radixSort);
+		glUniform1ui("count", GLuint(count));
+		glUniform1ui("pass", pass);
+		glUniform1i("scatter", true);
+		bindBuffer("keysIn", keys[from]);
+		bindBuffer("valuesIn", sortValues[from]);
+		bindBuffer("keysOut", keys[to]);
+		bindBuffer("valuesOut", sortValues[to]);
+		bindBuffer("digitCounts", digitCounts);
+		glDispatchCompute(groups, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	}
+
+	if (count > 1) {
+		glUseProgram(hierarchy);
+		glUniform1ui("count", GLuint(count));
+		bindBuffer("keysIn", keys[0]);
+		bindBuffer("lbvhLinks", links);
+		glDispatchCompute((GLuint(count) - 1 + 1023) / 1024, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	}
+
+	const GLuint zero = 0;
+	glClearNamedBufferData(arrivals, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+	glUseProgram(fit);
+	glUniform1ui("count", GLuint(count));
+	glUniform1i("hasExtents", extents != 0);
+	bindBuffer("points", points);
+	bindBuffer("extents", extents != 0 ? extents : points);
+	bindBuffer("indices", bvh.indices);
+	bindBuffer("nodes", bvh.nodes);
+	bindBuffer("lbvhLinks", links);
+	bindBuffer("lbvhArrivals", arrivals);
+	bindBuffer("buildExtents", bvh.buildExtents);
+	bindBuffer("buildIndices", bvh.buildIndices);
+	bindBuffer("buildSizes", bvh.buildSizes);
+	bindBuffer("buildParents", bvh.buildParents);
+	glDispatchCompute(groups, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+BvhRefitter::BvhRefitter() :
+	refitProgram(createProgram("shaders/bvhRefit.glsl")),
+	qualityProgram(createProgram("shaders/bvhQuality.glsl")) {
+}
+
+void BvhRefitter::reserve(GLsizei nodeCount) {
+	if (nodeCount <= capacity) return;
+	arrivals = Buffer();
+	glNamedBufferStorage(arrivals, sizeof(GLuint) * nodeCount, nullptr, 0);
+	partials = Buffer();
+	glNamedBufferStorage(partials, sizeof(GLfloat) * 2 * ((nodeCount + 1023) / 1024), nullptr, 0);
+	capacity = nodeCount;
+}
+
+void BvhRefitter::refit(GpuBvh& bvh, GLuint points, GLuint extents) {
+	if (bvh.nodeCapacity == 0 || bvh.pointCount == 0) return;
+	reserve(bvh.nodeCapacity);
+
+	const GLuint zero = 0, emptyBox[2] = { ~0u, 0u };
+	glClearNamedBufferData(arrivals, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+	glClearNamedBufferData(bvh.buildExtents, GL_RG32UI, GL_RG_INTEGER, GL_UNSIGNED_INT, emptyBox);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+	glUseProgram(refitProgram);
+	glUniform1ui("count", GLuint(bvh.pointCount));
+	glUniform1i("hasExtents", extents != 0);
+	bindBuffer("points", points);
+	bindBuffer("extents", extents != 0 ? extents : points);
+	bindBuffer("nodes", bvh.nodes);
+	bindBuffer("bvhArrivals", arrivals);
+	bindBuffer("buildExtents", bvh.buildExtents);
+	bindBuffer("buildIndices", bvh.buildIndices);
+	bindBuffer("buildSizes", bvh.buildSizes);
+	bindBuffer("buildParents", bvh.buildParents);
+	glUniform1i("emptyLeaves", true);
+	glDispatchCompute((GLuint(bvh.nodeCapacity) + 1023) / 1024, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	glUniform1i("emptyLeaves", false);
+	glDispatchCompute((GLuint(bvh.pointCount) + 1023) / 1024, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+BvhQuality BvhRefitter::measure(const GpuBvh& bvh) {
+	BvhQuality result;
+	if (bvh.nodeCapacity == 0) return result;
+	reserve(bvh.nodeCapacity);
+	const GLuint groups = (GLuint(bvh.nodeCapacity) + 1023) / 1024;
+	glUseProgram(qualityProgram);
+	bindBuffer("buildExtents", bvh.buildExtents);
+	bindBuffer("buildIndices", bvh.buildIndices);
+	bindBuffer("buildSizes", bvh.buildSizes);
+	bindBuffer("buildParents", bvh.buildParents);
+	bindBuffer("bvhPartials", partials);
+	glDispatchCompute(groups, 1, 1);
+	glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+	std::vector<float> sums(2 * groups);
+	glGetNamedBufferSubData(partials, 0, sizeof(float) * sums.size(), sums.data());
+	double cost = 0., overlap = 0.;
+	for (GLuint i = 0; i < groups; ++i) {
+		cost += sums[2 * i];
+		overlap += sums[2 * i + 1];
+	}
+	result.sahCost = float(cost);
+	result.overlap = float(overlap);
+	return result;
+}
+
+bool BvhRefitter::update(GpuBvh& bvh, LinearBvhBuilder& builder, GLuint points, GLuint extents, GLsizei count,
+	const RefitThresholds& thresholds) {
+	if (bvh.pointCount == count) {
+		refit(bvh, points, extents);
+		current = measure(bvh);
+		if (current.sahCost <= built.sahCost * thresholds.sahGrowth && current.overlap <= built.overlap * thresholds.overlapGrowth)
+			return false;
+	}
+	builder.build(bvh, points, extents, count);
+	current = built = measure(bvh);
+	return true;
+}
+
+NeighbourQueries::NeighbourQueries() : program(createProgram("shaders/bvhNeighbours.glsl")) {
+	glNamedBufferStorage(unfinished, sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+}
+
+void NeighbourQueries::nearest(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, unsigned k, float radius) {
+	run(bvh, points, queries, queryCount, k, radius, false);
+}
+
+void NeighbourQueries::withinRadius(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, float radius, unsigned k) {
+	run(bvh, points, queries, queryCount, k, radius, true);
+}
+
+void NeighbourQueries::run(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, unsigned k, float radius, bool countAll) {
+	if (k < 1 || k > 32 || queryCount < 1 || bvh.pointCount == 0) {
+		printf("NeighbourQueries: can't look for %u neighbours of %d queries in %d points\n", k, queryCount, bvh.pointCount);
+		return;
+	}
+	if (GLsizei(k) * queryCount > capacity) {
+		neighbours = Buffer();
+		glNamedBufferStorage(neighbours, sizeof(GLint) * k * queryCount, nullptr, 0);
+		distances = Buffer();
+		glNamedBufferStorage(distances, sizeof(GLfloat) * k * queryCount, nullptr, 0);
+		capacity = GLsizei(k) * queryCount;
+	}
+	if (queryCount > countCapacity) {
+		counts = Buffer();
+		glNamedBufferStorage(counts, sizeof(GLuint) * queryCount, nullptr, 0);
+		traversals = Buffer();
+		glNamedBufferStorage(traversals, sizeof(GLint) * traversalSize * queryCount, nullptr, 0);
+		countCapacity = queryCount;
+	}
+
+	glUseProgram(program);
+	glUniform1ui("pointCount", GLuint(bvh.pointCount));
+	glUniform1ui("queryCount", GLuint(queryCount));
+	glUniform1ui("k", k);
+	glUniform1f("radius", radius);
+	glUniform1i("countAll", countAll);
+	bindBuffer("points", points);
+	bindBuffer("queries", queries);
+	bindBuffer("buildExtents", bvh.buildExtents);
+	bindBuffer("buildIndices", bvh.buildIndices);
+	bindBuffer("buildSizes", bvh.buildSizes);
+	bindBuffer("buildParents", bvh.buildParents);
+	bindBuffer("indices", bvh.indices);
+	bindBuffer("neighbours", neighbours);
+	bindBuffer("distances", distances);
+	bindBuffer("neighbourCounts", counts);
+	bindBuffer("traversals", traversals);
+	bindBuffer("unfinished", unfinished);
+	// queries that run out of steps carry on in another dispatch, until none are left
+	for (bool resume = false;; resume = true) {
+		const GLuint zero = 0;
+		glClearNamedBufferData(unfinished, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+		glUniform1i("resume", resume);
+		glDispatchCompute((GLuint(queryCount) + 63) / 64, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+		GLuint left = 0;
+		glGetNamedBufferSubData(unfinished, 0, sizeof(left), &left);
+		if (left == 0) break;
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+
+#include "gl_helpers.h"
+#include "bvh.h"
+
+// point BVHs built and kept on the GPU, in the buffers and node layout of naive_bvh's tree (and FlatBvh's, see bvh.h), so the same
+// shaders draw and traverse a tree from any of the builders
+
+// the tree's buffers, named like the shaders bind them. a tree from elsewhere (naive_bvh's split.glsl) can be moved in as well
+struct GpuBvh {
+	Buffer buildExtents;	// per node and axis, (min, max) through sortable()
+	Buffer buildIndices;	// the node count, then per node its first child, or for a leaf where its points start in indices
+	Buffer buildSizes;		// points in a leaf, 0 for inner nodes
+	Buffer buildParents;	// -1 for the root
+	Buffer indices;			// point ids, the ones of each leaf back to back
+	Buffer nodes;			// the leaf each point ended up in
+	GLsizei pointCount = 0;							// in the tree
+	GLsizei pointCapacity = 0, nodeCapacity = 0;	// what the buffers have room for; the tree itself may use fewer nodes
+
+	// reads the tree back for sahCost() and friends; waits for the GPU
+	FlatBvh download() const;
+};
+
+// a linear BVH (Lauterbach et al., with Karras' fully parallel hierarchy): points are sorted by the morton code of their position in
+// the cloud's box, the binary radix tree over the codes is emitted one inner node per thread, and the boxes are fitted bottom up by
+// threads that climb from the leaves until they reach a node whose other child isn't done yet. the number of passes depends only on
+// the code length, not on the depth of the tree, and no two threads ever contend on the same node's bounds.
+// every leaf holds one point, so the tree has 2 count - 1 nodes, twice what naive_bvh allocates. the SAH comes out some 15% above
+// buildBvh()'s (bvh.h) on naive_bvh's cloud. nodes are numbered by the radix tree, not breadth first
+struct LinearBvhBuilder {
+	LinearBvhBuilder();
+
+	// points and extents (half sizes, 0 for none) are laid out like naive_bvh's: all x, then all y, then all z. bvh's buffers are
+	// replaced when they're too small. wideCodes sorts 63-bit codes instead of 30-bit ones, twice the passes, for clouds with detail
+	// finer than about a thousandth of their size. leaves the last build program bound
+	void build(GpuBvh& bvh, GLuint points, GLuint extents, GLsizei count, bool wideCodes = false);
+
+protected:
+	Program morton, radixSort, scan, hierarchy, fit;
+	Buffer box, keys[2], values, links, arrivals, digitCounts;
+	std::vector<Buffer> scanSums; // the block totals of each level of the digit count scan
+	GLsizei capacity = 0;
+	GLint maxGroups = 0;
+
+	// in place exclusive prefix sums of the first count values of data
+	void prefixSum(GLuint data, GLuint count, size_t level = 0);
+};
+
+// a tree's SAH cost with unit costs (like sahCost() in bvh.h, except that nodes with a size count as leaves) and its overlap: the
+// summed surface area of the intersections of all sibling pairs. both relative to the root's surface area
+struct BvhQuality {
+	float sahCost = 0.f;
+	float overlap = 0.f;
+};
+
+// how much worse than right after its build a refitted tree may get before BvhRefitter::update() builds it again
+struct RefitThresholds {
+	float sahGrowth = 1.25f;
+	float overlapGrowth = 2.f;
+};
+
+// keeps a tree over moving points: refitting keeps the topology and only recomputes the boxes, which costs a fraction of a build
+// but lets the tree degrade as points move away from the neighbours they were grouped with
+struct BvhRefitter {
+	BvhRefitter();
+
+	// every box from the points' (and extents') current positions, from the bottom up; works on a tree from any builder.
+	// leaves the refit program bound
+	void refit(GpuBvh& bvh, GLuint points, GLuint extents);
+	// measured on the GPU; reads back a value pair per 1024 nodes, so it waits for the GPU
+	BvhQuality measure(const GpuBvh& bvh);
+
+	// refits, then rebuilds with builder if the refitted tree has crossed the thresholds relative to the quality measured after the
+	// last rebuild (or if there's no tree over count points yet). returns whether it rebuilt
+	bool update(GpuBvh& bvh, LinearBvhBuilder& builder, GLuint points, GLuint extents, GLsizei count,
+		const RefitThresholds& thresholds = RefitThresholds());
+
+	BvhQuality built;		// right after the last rebuild by update()
+	BvhQuality current;		// after the last update()
+
+protected:
+	Program refitProgram, qualityProgram;
+	Buffer arrivals, partials;
+	GLsizei capacity = 0;
+
+	void reserve(GLsizei nodeCount);
+};
+
+// nearest neighbour and fixed radius queries among a GpuBvh's points, one GPU thread per query (see bvhNeighbours.glsl).
+// the tree has to list its points in indices, which LinearBvhBuilder's and buildPointBvh()'s do and naive_bvh's split.glsl doesn't
+struct NeighbourQueries {
+	NeighbourQueries();
+
+	// queries are laid out like the points: all x, then all y, then all z. per query, the k nearest points (k at most 32) no farther
+	// than radius: neighbours gets their indices (nearest first, -1 past the last one found) and distances the distances (infinity
+	// past the last one), both k per query, and counts how many were found. queries too long for one dispatch are carried on in
+	// more, so this waits for the GPU to tell whether any are left. leaves the query program bound
+	void nearest(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, unsigned k, float radius = INFINITY);
+	// the same k nearest, but counts gets every point within radius rather than only the ones kept; slower than nearest(), since
+	// finding k points doesn't narrow the search
+	void withinRadius(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, float radius, unsigned k);
+
+	Buffer neighbours, distances, counts;	// replaced when the last call needed more room
+
+protected:
+	static constexpr GLsizei traversalSize = 41;	// ints of state per query between dispatches, see bvhNeighbours.glsl
+	Program program;
+	Buffer traversals, unfinished;
+	GLsizei capacity = 0, countCapacity = 0;
+
+	void run(const GpuBvh& bvh, GLuint points, GLuint queries, GLsizei queryCount, unsigned k, float radius, bool countAll);
+};
@@ -0,0 +1,1189 @@
+
+#include "image_loader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <algorithm>
+
+namespace {
+
+	// all decoders report through this and return an empty image; they all write rows bottom-up directly
+	ImageData fail(const char* what) {
+		printf("decodeImage: %s\n", what);
+		return ImageData();
+	}
+
+	inline uint32_t bigEndian32(const uint8_t* p) { return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3]; }
+	inline uint16_t bigEndian16(const uint8_t* p) { return uint16_t((p[0] << 8) | p[1]); }
+
+	// ---- inflate (rfc 1951) ----
+
+	// least significant bit first, as deflate wants; reading past the end yields zeros and flags the stream as broken
+	struct BitReader {
+		const uint8_t* data;
+		size_t size, position = 0;
+		uint64_t bits = 0;
+		int count = 0;
+		BitReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+		void refill() {
+			if (position + 8 <= size) {
+				uint64_t next;
+				memcpy(&next, data + position, 8); // little endian hosts only, like the rest of the GL side
+				bits |= next << count;
+				position += (63 - count) >> 3;
+				count |= 56;
+				return;
+			}
+			while (count <= 56) {
+				bits |= uint64_t(position < size ? data[position] : 0) << count;
+				++position;
+				count += 8;
+			}
+		}
+		uint32_t get(int n) {
+			if (count < n) refill();
+			const uint32_t result = uint32_t(bits & ((uint64_t(1) << n) - 1));
+			bits >>= n; count -= n;
+			return result;
+		}
+		bool overrun() const { return position - count / 8 > size; }
+	};
+
+	inline int reverseBits(int code, int length) {
+		int result = 0;
+		for (int i = 0; i < length; ++i, code >>= 1)
+			result = (result << 1) | (code & 1);
+		return result;
+	}
+
+	// canonical huffman table: codes up to fastBits long resolve with one lookup, longer ones walk the length classes
+	struct Huffman {
+		static constexpr int fastBits = 9;
+		uint16_t fast[1 << fastBits];	// (length << 9) | symbol, 0 when the code is longer
+		uint16_t firstCode[16], firstSymbol[16];
+		int maxCode[17];				// first code past each length, left-aligned to 16 bits
+		uint16_t symbols[288];
+		int symbolCount;
+
+		bool build(const uint8_t* lengths, int count) {
+			int sizes[16] = { 0 };
+			for (int i = 0; i < count; ++i)
+				sizes[lengths[i]]++;
+			sizes[0] = 0;
+			int code = 0, symbol = 0, nextCode[16];
+			for (int i = 1; i < 16; ++i) {
+				nextCode[i] = firstCode[i] = uint16_t(code);
+				firstSymbol[i] = uint16_t(symbol);
+				code += sizes[i];
+				if (sizes[i] && code > (1 << i)) return false;
+				maxCode[i] = code << (16 - i);
+				code <<= 1;
+				symbol += sizes[i];
+			}
+			maxCode[16] = 0x10000;
+			symbolCount = symbol;
+			memset(fast, 0, sizeof(fast));
+			for (int i = 0; i < count; ++i) {
+				const int length = lengths[i];
+				if (!length) continue;
+				symbols[nextCode[length] - firstCode[length] + firstSymbol[length]] = uint16_t(i);
+				if (length <= fastBits)
+					for (int j = reverseBits(nextCode[length], length); j < (1 << fastBits); j += 1 << length)
+						fast[j] = uint16_t((length << fastBits) | i);
+				++nextCode[length];
+			}
+			return true;
+		}
+
+		int decode(BitReader& reader) const {
+			if (reader.count < 16) reader.refill();
+			const int entry = fast[reader.bits & ((1 << fastBits) - 1)];
+			if (entry) {
+				const int length = entry >> fastBits;
+				reader.bits >>= length; reader.count -= length;
+				return entry & ((1 << fastBits) - 1);
+			}
+			const int k = reverseBits(int(reader.bits & 0xFFFF), 16);
+			int length = fastBits + 1;
+			while (length < 16 && k >= maxCode[length]) ++length;
+			if (length == 16) return -1;
+			const int index = (k >> (16 - length)) - firstCode[length] + firstSymbol[length];
+			if (index < 0 || index >= symbolCount) return -1;
+			reader.bits >>= length; reader.count -= length;
+			return symbols[index];
+		}
+	};
+
+	const uint16_t lengthBase[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+	const uint8_t lengthExtra[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+	const uint16_t distanceBase[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+	const uint8_t distanceExtra[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+	// zlib stream -> bytes; expectedSize is only a hint for the first allocation
+	bool inflate(const uint8_t* data, size_t size, std::vector<uint8_t>& output, size_t expectedSize) {
+		if (size < 2 || (data[0] & 15) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 32)) return false;
+		BitReader reader(data + 2, size - 2);
+		// deflate can't do better than about 1032:1, so a corrupt size hint can't make us allocate more than the data could hold
+		output.resize(expectedSize > 0 && expectedSize / 1032 <= size ? expectedSize : size * 4);
+		size_t written = 0;
+		auto reserve = [&](size_t count) {
+			if (written + count > output.size())
+				output.resize((written + count) * 2);
+		};
+
+		Huffman literals, distances;
+		bool last = false;
+		while (!last) {
+			last = reader.get(1) != 0;
+			const uint32_t type = reader.get(2);
+			if (type == 0) {
+				reader.get(reader.count & 7);
+				const uint32_t length = reader.get(16), inverse = reader.get(16);
+				if ((length ^ 0xFFFF) != inverse) return false;
+				reserve(length);
+				for (uint32_t i = 0; i < length; ++i)
+					output[written++] = uint8_t(reader.get(8));
+				continue;
+			}
+			if (type == 1) {
+				uint8_t lengths[288 + 32];
+				memset(lengths, 8, 144); memset(lengths + 144, 9, 112); memset(lengths + 256, 7, 24); memset(lengths + 280, 8, 8);
+				memset(lengths + 288, 5, 32);
+				literals.build(lengths, 288);
+				distances.build(lengths + 288, 32);
+			}
+			else if (type == 2) {
+				const int literalCount = reader.get(5) + 257, distanceCount = reader.get(5) + 1, codeCount = reader.get(4) + 4;
+				static const uint8_t order[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+				uint8_t codeLengths[19] = { 0 };
+				for (int i = 0; i < codeCount; ++i)
+					codeLengths[order[i]] = uint8_t(reader.get(3));
+				Huffman codes;
+				if (!codes.build(codeLengths, 19)) return false;
+				uint8_t lengths[288 + 32];
+				int n = 0;
+				while (n < literalCount + distanceCount) {
+					const int symbol = codes.decode(reader);
+					if (symbol < 0) return false;
+					if (symbol < 16) { lengths[n++] = uint8_t(symbol); continue; }
+					int repeat; uint8_t value = 0;
+					if (symbol == 16) { if (n == 0) return false; value = lengths[n - 1]; repeat = 3 + reader.get(2); }
+					else if (symbol == 17) repeat = 3 + reader.get(3);
+					else repeat = 11 + reader.get(7);
+					if (n + repeat > literalCount + distanceCount) return false;
+					memset(lengths + n, value, repeat);
+					n += repeat;
+				}
+				if (!literals.build(lengths, literalCount) || !distances.build(lengths + literalCount, distanceCount)) return false;
+			}
+			else
+				return false;
+
+			for (;;) {
+				const int symbol = literals.decode(reader);
+				if (symbol < 0 || reader.overrun()) return false;
+				if (symbol < 256) {
+					reserve(1);
+					output[written++] = uint8_t(symbol);
+					continue;
+				}
+				if (symbol == 256) break;
+				if (symbol > 285) return false;
+				const int length = lengthBase[symbol - 257] + reader.get(lengthExtra[symbol - 257]);
+				const int distanceSymbol = distances.decode(reader);
+				if (distanceSymbol < 0 || distanceSymbol >= 30) return false;
+				const size_t distance = distanceBase[distanceSymbol] + reader.get(distanceExtra[distanceSymbol]);
+				if (distance > written) return false;
+				reserve(length);
+				uint8_t* out = output.data() + written;
+				const uint8_t* from = out - distance;
+				for (int i = 0; i < length; ++i) out[i] = from[i]; // may overlap on purpose
+				written += length;
+			}
+		}
+		if (reader.overrun()) return false;
+		output.resize(written);
+		return true;
+	}
+
+	// ---- png ----
+
+	inline uint8_t paeth(int a, int b, int c) {
+		const int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+		return uint8_t(pa <= pb && pa <= pc ? a : (pb <= pc ? b : c));
+	}
+
+	// undoes the per-row filter in place; previous is the already unfiltered row above (or null).
+	// the first pixel has no left neighbour, so each filter handles it separately to keep the main loops branch free
+	bool unfilter(uint8_t filter, uint8_t* row, const uint8_t* previous, size_t length, int bytesPerPixel) {
+		const size_t bpp = size_t(bytesPerPixel);
+		if (!previous && (filter == 2 || filter == 4))
+			filter = filter == 2 ? 0 : 1; // paeth with a zero row above is just the left neighbour
+		switch (filter) {
+		case 0: break;
+		case 1: for (size_t i = bpp; i < length; ++i) row[i] += row[i - bpp]; break;
+		case 2: for (size_t i = 0; i < length; ++i) row[i] += previous[i]; break;
+		case 3:
+			if (previous) {
+				for (size_t i = 0; i < bpp && i < length; ++i) row[i] += previous[i] >> 1;
+				for (size_t i = bpp; i < length; ++i) row[i] += uint8_t((row[i - bpp] + previous[i]) >> 1);
+			}
+			else
+				for (size_t i = bpp; i < length; ++i) row[i] += row[i - bpp] >> 1;
+			break;
+		case 4:
+			for (size_t i = 0; i < bpp && i < length; ++i) row[i] += previous[i];
+			for (size_t i = bpp; i < length; ++i) row[i] += paeth(row[i - bpp], previous[i], previous[i - bpp]);
+			break;
+		default: return false;
+		}
+		return true;
+	}
+
+	struct PngHeader {
+		int width, height, depth, colorType, samples;
+		bool interlaced;
+		uint8_t palette[256][4];
+		bool hasKey = false;
+		uint16_t key[3];	// transparent gray or rgb value, at full depth
+		bool hasAlpha() const { return colorType == 4 || colorType == 6 || hasKey; }
+	};
+
+	// raw sample at the file's depth
+	inline uint32_t pngSample(const uint8_t* row, size_t index, int depth) {
+		if (depth == 8) return row[index];
+		if (depth == 16) return bigEndian16(row + index * 2);
+		const size_t bit = index * depth;
+		return (row[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+	}
+
+	// one unfiltered row of the file's format -> 8-bit rgb(a), written every step texels
+	void expandPngRow(const PngHeader& png, const uint8_t* row, int width, uint8_t* out, int channels, int step) {
+		const int depth = png.depth;
+		// the common case is already in the right layout
+		if (depth == 8 && step == 1 && ((png.colorType == 6) || (png.colorType == 2 && !png.hasKey))) {
+			memcpy(out, row, size_t(width) * channels);
+			return;
+		}
+		auto to8 = [depth](uint32_t v) { return uint8_t(depth == 16 ? v >> 8 : depth == 8 ? v : v * 255 / ((1 << depth) - 1)); };
+		for (int x = 0; x < width; ++x, out += size_t(channels) * step) {
+			uint8_t alpha = 255;
+			switch (png.colorType) {
+			case 0: {
+				const uint32_t g = pngSample(row, x, depth);
+				out[0] = out[1] = out[2] = to8(g);
+				if (png.hasKey && g == png.key[0]) alpha = 0;
+				break;
+			}
+			case 2: {
+				uint32_t c[3];
+				for (int i = 0; i < 3; ++i) out[i] = to8(c[i] = pngSample(row, size_t(x) * 3 + i, depth));
+				if (png.hasKey && c[0] == png.key[0] && c[1] == png.key[1] && c[2] == png.key[2]) alpha = 0;
+				break;
+			}
+			case 3: {
+				const uint8_t* entry = png.palette[pngSample(row, x, depth) & 255];
+				out[0] = entry[0]; out[1] = entry[1]; out[2] = entry[2]; alpha = entry[3];
+				break;
+			}
+			case 4:
+				out[0] = out[1] = out[2] = to8(pngSample(row, size_t(x) * 2, depth));
+				alpha = to8(pngSample(row, size_t(x) * 2 + 1, depth));
+				break;
+			case 6:
+				for (int i = 0; i < 3; ++i) out[i] = to8(pngSample(row, size_t(x) * 4 + i, depth));
+				alpha = to8(pngSample(row, size_t(x) * 4 + 3, depth));
+				break;
+			}
+			if (channels == 4) out[3] = alpha;
+		}
+	}
+
+	ImageData decodePng(const uint8_t* data, size_t size) {
+		PngHeader png = {};
+		std::vector<uint8_t> compressed;
+		bool hasHeader = false;
+		for (size_t position = 8; position + 12 <= size;) {
+			const uint32_t length = bigEndian32(data + position);
+			const uint8_t* type = data + position + 4;
+			const uint8_t* chunk = data + position + 8;
+			if (length > size - position - 12) return fail("truncated png chunk");
+			if (!memcmp(type, "IHDR", 4) && length >= 13) {
+				png.width = int(bigEndian32(chunk)); png.height = int(bigEndian32(chunk + 4));
+				png.depth = chunk[8]; png.colorType = chunk[9]; png.interlaced = chunk[12] == 1;
+				static const int samples[7] = { 1, 0, 3, 1, 2, 0, 4 };
+				png.samples = png.colorType <= 6 ? samples[png.colorType] : 0;
+				if (png.samples == 0 || chunk[10] != 0 || chunk[11] != 0) return fail("unsupported png color type or compression");
+				if (png.depth != 1 && png.depth != 2 && png.depth != 4 && png.depth != 8 && png.depth != 16) return fail("bad png bit depth");
+				if (png.width <= 0 || png.height <= 0 || png.width > (1 << 24) || png.height > (1 << 24)) return fail("bad png size");
+				for (auto& entry : png.palette) entry[0] = entry[1] = entry[2] = 0, entry[3] = 255;
+				hasHeader = true;
+			}
+			else if (!memcmp(type, "PLTE", 4)) {
+				for (uint32_t i = 0; i < length / 3 && i < 256; ++i)
+					for (int c = 0; c < 3; ++c) png.palette[i][c] = chunk[i * 3 + c];
+			}
+			else if (!memcmp(type, "tRNS", 4)) {
+				if (png.colorType == 3)
+					for (uint32_t i = 0; i < length && i < 256; ++i) png.palette[i][3] = chunk[i];
+				else if (png.colorType == 0 && length >= 2)
+					png.hasKey = true, png.key[0] = bigEndian16(chunk);
+				else if (png.colorType == 2 && length >= 6)
+					png.hasKey = true, png.key[0] = bigEndian16(chunk), png.key[1] = bigEndian16(chunk + 2), png.key[2] = bigEndian16(chunk + 4);
+			}
+			else if (!memcmp(type, "IDAT", 4))
+				compressed.insert(compressed.end(), chunk, chunk + length);
+			else if (!memcmp(type, "IEND", 4))
+				break;
+			position += 12 + length;
+		}
+		if (!hasHeader || compressed.empty()) return fail("png without header or image data");
+		if (png.colorType == 3) {
+			// a palette with any transparency needs the alpha channel
+			for (auto& entry : png.palette) png.hasKey = png.hasKey || entry[3] != 255;
+		}
+
+		const int bitsPerPixel = png.depth * png.samples, bytesPerPixel = bitsPerPixel < 8 ? 1 : bitsPerPixel / 8;
+		// adam7 passes: offset and step in x and y; a non-interlaced image is one pass over everything
+		static const int adam7[7][4] = { { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 } };
+		static const int single[1][4] = { { 0, 0, 1, 1 } };
+		const int (*passes)[4] = png.interlaced ? adam7 : single;
+		const int passCount = png.interlaced ? 7 : 1;
+
+		size_t expected = 0;
+		for (int p = 0; p < passCount; ++p) {
+			const size_t w = (png.width - passes[p][0] + passes[p][2] - 1) / passes[p][2], h = (png.height - passes[p][1] + passes[p][3] - 1) / passes[p][3];
+			if (w && h) expected += h * (1 + (w * bitsPerPixel + 7) / 8);
+		}
+		std::vector<uint8_t> raw;
+		if (!inflate(compressed.data(), compressed.size(), raw, expected) || raw.size() < expected) return fail("corrupt png data");
+
+		// only allocated once the data has proven to be there
+		ImageData image;
+		image.width = png.width; image.height = png.height;
+		image.channels = png.hasAlpha() ? 4 : 3;
+		image.texels.resize(size_t(image.width) * image.height * image.channels);
+
+		uint8_t* rows = raw.data();
+		for (int p = 0; p < passCount; ++p) {
+			const int x0 = passes[p][0], y0 = passes[p][1], dx = passes[p][2], dy = passes[p][3];
+			if (x0 >= png.width || y0 >= png.height) continue;
+			const int w = (png.width - x0 + dx - 1) / dx, h = (png.height - y0 + dy - 1) / dy;
+			const size_t length = (size_t(w) * bitsPerPixel + 7) / 8;
+			const uint8_t* previous = nullptr;
+			for (int y = 0; y < h; ++y) {
+				uint8_t* row = rows + 1;
+				if (!unfilter(rows[0], row, previous, length, bytesPerPixel)) return fail("bad png filter");
+				expandPngRow(png, row, w, image.texels.data() + (size_t(png.height - 1 - (y0 + y * dy)) * image.width + x0) * image.channels, image.channels, dx);
+				previous = row;
+				rows += 1 + length;
+			}
+		}
+		return image;
+	}
+
+	// ---- baseline jpeg ----
+
+	const uint8_t zigzag[64 + 16] = {
+		0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5, 12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+		35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+		// corrupt run lengths can push past the end; these land harmlessly
+		63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63 };
+
+	// most significant bit first; byte stuffing is undone here and a marker stops the stream (zeros are fed instead)
+	struct JpegReader {
+		const uint8_t* data;
+		size_t size, position;
+		uint32_t bits = 0;
+		int count = 0;
+		bool atMarker = false;
+		void fill() {
+			while (count <= 24) {
+				uint32_t byte = 0;
+				if (!atMarker && position < size) {
+					byte = data[position];
+					if (byte == 0xFF) {
+						if (position + 1 < size && data[position + 1] == 0) position += 2;
+						else { atMarker = true; byte = 0; }
+					}
+					else ++position;
+				}
+				bits |= byte << (24 - count);
+				count += 8;
+			}
+		}
+		int get(int n) {
+			if (n == 0) return 0;
+			if (count < n) fill();
+			const int result = int(bits >> (32 - n));
+			bits <<= n; count -= n;
+			return result;
+		}
+		void reset() { bits = 0; count = 0; atMarker = false; }
+	};
+
+	struct JpegHuffman {
+		uint8_t fast[1 << 9];	// index into values, 255 when the code is longer
+		uint8_t values[256], sizes[257];
+		uint16_t codes[256];
+		uint32_t maxCode[18];
+		int delta[17];
+
+		bool build(const uint8_t* counts, const uint8_t* symbols) {
+			int k = 0;
+			for (int length = 1; length <= 16; ++length)
+				for (int i = 0; i < counts[length - 1]; ++i) {
+					if (k >= 256) return false;
+					sizes[k++] = uint8_t(length);
+				}
+			sizes[k] = 0;
+			memcpy(values, symbols, k);
+			int code = 0;
+			k = 0;
+			for (int length = 1; length <= 16; ++length) {
+				delta[length] = k - code;
+				while (sizes[k] == length) codes[k++] = uint16_t(code++);
+				if (code - 1 >= (1 << length)) return false;
+				maxCode[length] = uint32_t(code) << (16 - length);
+				code <<= 1;
+			}
+			maxCode[17] = 0xFFFFFFFF;
+			memset(fast, 255, sizeof(fast));
+			for (int i = 0; i < k; ++i)
+				if (sizes[i] <= 9) {
+					const int first = codes[i] << (9 - sizes[i]), span = 1 << (9 - sizes[i]);
+					for (int j = 0; j < span; ++j) fast[first + j] = uint8_t(i);
+				}
+			return true;
+		}
+
+		int decode(JpegReader& reader) const {
+			if (reader.count < 16) reader.fill();
+			const int index = fast[reader.bits >> (32 - 9)];
+			if (index != 255) {
+				reader.bits <<= sizes[index]; reader.count -= sizes[index];
+				return values[index];
+			}
+			const uint32_t top = reader.bits >> 16;
+			int length = 10;
+			while (top >= maxCode[length]) ++length;
+			if (length == 17) return -1;
+			const int symbol = int(reader.bits >> (32 - length)) + delta[length];
+			if (symbol < 0 || symbol > 255) return -1;
+			reader.bits <<= length; reader.count -= length;
+			return values[symbol];
+		}
+	};
+
+	inline int extend(int value, int length) {
+		return length == 0 ? 0 : (value < (1 << (length - 1)) ? value - (1 << length) + 1 : value);
+	}
+
+	// AAN scale factors: cos(k*pi/16)*sqrt(2), 1 for dc. folded into the dequantization so the idct itself needs only 5 multiplies per 1d pass
+	const float aanScale[8] = { 1.f, 1.387039845f, 1.306562965f, 1.175875602f, 1.f, .785694958f, .541196100f, .275899379f };
+
+	// one 8-point AAN inverse dct (the float variant libjpeg uses); in and out are strided
+	template<typename Out>
+	inline void inverseDct8(const float* in, int stride, Out out) {
+		float even0 = in[0], even1 = in[2 * stride], even2 = in[4 * stride], even3 = in[6 * stride];
+		const float sum02 = even0 + even2, difference02 = even0 - even2;
+		const float sum13 = even1 + even3, rotated13 = (even1 - even3) * 1.414213562f - sum13;
+		even0 = sum02 + sum13; even3 = sum02 - sum13;
+		even1 = difference02 + rotated13; even2 = difference02 - rotated13;
+
+		const float odd4 = in[stride], odd5 = in[3 * stride], odd6 = in[5 * stride], odd7 = in[7 * stride];
+		const float z13 = odd6 + odd5, z10 = odd6 - odd5, z11 = odd4 + odd7, z12 = odd4 - odd7;
+		const float t7 = z11 + z13, t11 = (z11 - z13) * 1.414213562f;
+		const float z5 = (z10 + z12) * 1.847759065f;
+		const float t10 = 1.082392200f * z12 - z5, t12 = -2.613125930f * z10 + z5;
+		const float t6 = t12 - t7, t5 = t11 - t6, t4 = t10 + t5;
+
+		out(0, even0 + t7); out(7, even0 - t7);
+		out(1, even1 + t6); out(6, even1 - t6);
+		out(2, even2 + t5); out(5, even2 - t5);
+		out(4, even3 + t4); out(3, even3 - t4);
+	}
+
+	// coefficients in natural order and already multiplied by the AAN factors; output clamped to bytes
+	void inverseDct(const float* coefficients, uint8_t* out, size_t stride) {
+		float columns[64];
+		for (int x = 0; x < 8; ++x) {
+			const float* c = coefficients + x;
+			// most high frequency coefficients are zero; a column with just dc is flat
+			if (c[8] == 0.f && c[16] == 0.f && c[24] == 0.f && c[32] == 0.f && c[40] == 0.f && c[48] == 0.f && c[56] == 0.f) {
+				for (int y = 0; y < 8; ++y) columns[y * 8 + x] = c[0];
+				continue;
+			}
+			inverseDct8(c, 8, [&](int y, float value) { columns[y * 8 + x] = value; });
+		}
+		for (int y = 0; y < 8; ++y) {
+			uint8_t* row = out + y * stride;
+			inverseDct8(columns + y * 8, 1, [row](int x, float value) {
+				value += 128.5f;
+				row[x] = uint8_t(value < 0.f ? 0.f : value > 255.f ? 255.f : value);
+			});
+		}
+	}
+
+	struct JpegComponent {
+		int id, h, v, quantization, dcTable = 0, acTable = 0, prediction = 0;
+		int blocksX = 0, blocksY = 0;	// blocks stored in the plane (whole MCUs)
+		std::vector<uint8_t> plane;	// blocksX*8 wide
+	};
+
+	ImageData decodeJpeg(const uint8_t* data, size_t size) {
+		uint16_t quantization[4][64] = {};
+		JpegHuffman tables[2][4];
+		bool tableSet[2][4] = {};
+		std::vector<JpegComponent> components;
+		int width = 0, height = 0, hMax = 1, vMax = 1, mcusX = 0, mcusY = 0, restartInterval = 0;
+		int adobeTransform = -1;
+		bool frame = false, scanned = false;
+
+		size_t position = 2;
+		while (position + 4 <= size) {
+			if (data[position] != 0xFF) { ++position; continue; }
+			const uint8_t marker = data[position + 1];
+			if (marker == 0xFF) { ++position; continue; }
+			if (marker == 0xD9) break;
+			if (marker == 0xD8 || (marker >= 0xD0 && marker <= 0xD7)) { position += 2; continue; }
+			const size_t length = bigEndian16(data + position + 2);
+			const uint8_t* segment = data + position + 4;
+			if (length < 2 || position + 2 + length > size) return fail("truncated jpeg segment");
+			const size_t end = position + 2 + length;
+
+			switch (marker) {
+			case 0xDB: // quantization tables
+				for (const uint8_t* p = segment; p < data + end;) {
+					const int precision = *p >> 4, id = *p & 3;
+					if (p + 1 + (precision ? 128 : 64) > data + end) return fail("bad jpeg quantization table");
+					++p;
+					for (int i = 0; i < 64; ++i, p += precision ? 2 : 1)
+						quantization[id][i] = precision ? bigEndian16(p) : *p;
+				}
+				break;
+			case 0xC4: // huffman tables
+				for (const uint8_t* p = segment; p + 17 <= data + end;) {
+					const int tableClass = *p >> 4, id = *p & 3;
+					if (tableClass > 1) return fail("bad jpeg huffman table");
+					int total = 0;
+					for (int i = 0; i < 16; ++i) total += p[1 + i];
+					if (p + 17 + total > data + end || !tables[tableClass][id].build(p + 1, p + 17)) return fail("bad jpeg huffman table");
+					tableSet[tableClass][id] = true;
+					p += 17 + total;
+				}
+				break;
+			case 0xDD:
+				if (length < 4) return fail("bad jpeg restart interval");
+				restartInterval = bigEndian16(segment);
+				break;
+			case 0xEE: // adobe: tells whether 3 components are YCbCr or RGB
+				if (length >= 14 && !memcmp(segment, "Adobe", 5)) adobeTransform = segment[11];
+				break;
+			case 0xC0: case 0xC1: {
+				if (frame) return fail("jpeg with more than one frame");
+				if (length < 8 || segment[0] != 8) return fail("only 8-bit jpegs are supported");
+				height = bigEndian16(segment + 1); width = bigEndian16(segment + 3);
+				const int count = segment[5];
+				if (length < size_t(8 + count * 3)) return fail("truncated jpeg frame");
+				if (width == 0 || height == 0 || (count != 1 && count != 3)) return fail("unsupported jpeg size or component count");
+				for (int i = 0; i < count; ++i) {
+					JpegComponent c;
+					c.id = segment[6 + i * 3];
+					c.h = segment[7 + i * 3] >> 4; c.v = segment[7 + i * 3] & 15;
+					c.quantization = segment[8 + i * 3] & 3;
+					if (c.h < 1 || c.h > 4 || c.v < 1 || c.v > 4) return fail("bad jpeg sampling factors");
+					hMax = c.h > hMax ? c.h : hMax; vMax = c.v > vMax ? c.v : vMax;
+					components.push_back(c);
+				}
+				mcusX = (width + 8 * hMax - 1) / (8 * hMax);
+				mcusY = (height + 8 * vMax - 1) / (8 * vMax);
+				// every block takes at least two bits (dc and end of block), which bounds what a corrupt header can ask for
+				if (size_t(mcusX) * mcusY * hMax * vMax > (size - end) * 4) return fail("jpeg frame is larger than its data");
+				for (auto& c : components) {
+					c.blocksX = mcusX * c.h; c.blocksY = mcusY * c.v;
+					c.plane.assign(size_t(c.blocksX) * c.blocksY * 64, 0);
+				}
+				frame = true;
+				break;
+			}
+			case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7: case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+				return fail("progressive, lossless and arithmetic coded jpegs are not supported");
+			case 0xDA: {
+				if (!frame) return fail("jpeg scan before frame");
+				const int count = segment[0];
+				if (count < 1 || count > int(components.size()) || length < size_t(6 + count * 2)) return fail("bad jpeg scan header");
+				std::vector<JpegComponent*> scan;
+				for (int i = 0; i < count; ++i) {
+					const int id = segment[1 + i * 2];
+					auto c = std::find_if(components.begin(), components.end(), [id](const JpegComponent& c) { return c.id == id; });
+					if (c == components.end()) return fail("jpeg scan names an unknown component");
+					c->dcTable = segment[2 + i * 2] >> 4; c->acTable = segment[2 + i * 2] & 3;
+					if (c->dcTable > 3 || !tableSet[0][c->dcTable] || !tableSet[1][c->acTable]) return fail("jpeg scan uses a missing huffman table");
+					c->prediction = 0;
+					scan.push_back(&*c);
+				}
+
+				// tables may change between scans, so they're (re)scaled here: natural order, AAN factors and the final /8 included
+				float dequantization[4][64];
+				for (int id = 0; id < 4; ++id)
+					for (int i = 0; i < 64; ++i)
+						dequantization[id][zigzag[i]] = quantization[id][i] * aanScale[zigzag[i] >> 3] * aanScale[zigzag[i] & 7] * .125f;
+
+				JpegReader reader{ data, size, end };
+				float coefficients[64];
+				auto decodeBlock = [&](JpegComponent& c, int bx, int by) {
+					const float* q = dequantization[c.quantization];
+					memset(coefficients, 0, sizeof(coefficients));
+					const int dcLength = tables[0][c.dcTable].decode(reader);
+					if (dcLength < 0 || dcLength > 16) return false;
+					c.prediction += extend(reader.get(dcLength), dcLength);
+					coefficients[0] = c.prediction * q[0];
+					for (int k = 1; k < 64;) {
+						const int rs = tables[1][c.acTable].decode(reader);
+						if (rs < 0) return false;
+						const int run = rs >> 4, length = rs & 15;
+						if (length == 0) {
+							if (run != 15) break;
+							k += 16;
+							continue;
+						}
+						k += run;
+						if (k > 63) return false;
+						coefficients[zigzag[k]] = extend(reader.get(length), length) * q[zigzag[k]];
+						++k;
+					}
+					inverseDct(coefficients, c.plane.data() + (size_t(by) * 8 * c.blocksX + size_t(bx)) * 8, size_t(c.blocksX) * 8);
+					return true;
+				};
+
+				// a single-component scan covers just that component's blocks, not whole MCUs
+				const bool interleaved = scan.size() > 1;
+				const int unitsX = interleaved ? mcusX : (width * scan[0]->h / hMax + 7) / 8;
+				const int unitsY = interleaved ? mcusY : (height * scan[0]->v / vMax + 7) / 8;
+				int untilRestart = restartInterval;
+				for (int uy = 0; uy < unitsY; ++uy)
+					for (int ux = 0; ux < unitsX; ++ux) {
+						if (restartInterval && untilRestart-- == 0) {
+							// the reader stopped at the marker; step over it and start fresh
+							reader.reset();
+							while (reader.position + 1 < size && !(data[reader.position] == 0xFF && data[reader.position + 1] >= 0xD0 && data[reader.position + 1] <= 0xD7))
+								++reader.position;
+							reader.position += 2;
+							for (auto* c : scan) c->prediction = 0;
+							untilRestart = restartInterval - 1;
+						}
+						for (auto* c : scan) {
+							const int blocksH = interleaved ? c->h : 1, blocksV = interleaved ? c->v : 1;
+							for (int by = 0; by < blocksV; ++by)
+								for (int bx = 0; bx < blocksH; ++bx)
+									if (!decodeBlock(*c, ux * blocksH + bx, uy * blocksV + by))
+										return fail("corrupt jpeg data");
+						}
+					}
+
+				// find the next marker after the entropy coded data
+				position = reader.position;
+				while (position + 1 < size && !(data[position] == 0xFF && data[position + 1] != 0 && !(data[position + 1] >= 0xD0 && data[position + 1] <= 0xD7)))
+					++position;
+				scanned = true;
+				continue;
+			}
+			default: break; // app segments, comments
+			}
+			position = end;
+		}
+		if (!scanned) return fail("jpeg without image data");
+
+		ImageData image;
+		image.width = width; image.height = height; image.channels = 3;
+		image.texels.resize(size_t(width) * height * 3);
+		const bool rgb = components.size() == 3 && (adobeTransform == 0 || (components[0].id == 'R' && components[1].id == 'G' && components[2].id == 'B'));
+		// nearest upsampling: which plane column each output column reads, per component
+		std::vector<int> columns(components.size() * width);
+		for (size_t i = 0; i < components.size(); ++i)
+			for (int x = 0; x < width; ++x)
+				columns[i * width + x] = x * components[i].h / hMax;
+		for (int y = 0; y < height; ++y) {
+			uint8_t* out = image.texels.data() + size_t(height - 1 - y) * width * 3;
+			const uint8_t* planes[3];
+			for (size_t i = 0; i < components.size(); ++i)
+				planes[i] = components[i].plane.data() + size_t(y * components[i].v / vMax) * components[i].blocksX * 8;
+			if (components.size() == 1) {
+				for (int x = 0; x < width; ++x, out += 3)
+					out[0] = out[1] = out[2] = planes[0][x];
+				continue;
+			}
+			const int* column0 = columns.data(), * column1 = column0 + width, * column2 = column1 + width;
+			for (int x = 0; x < width; ++x, out += 3) {
+				const uint8_t s0 = planes[0][column0[x]], s1 = planes[1][column1[x]], s2 = planes[2][column2[x]];
+				if (rgb) {
+					out[0] = s0; out[1] = s1; out[2] = s2;
+					continue;
+				}
+				const float luma = s0, cb = s1 - 128.f, cr = s2 - 128.f;
+				const float r = luma + 1.402f * cr + .5f, g = luma - .344136f * cb - .714136f * cr + .5f, b = luma + 1.772f * cb + .5f;
+				out[0] = uint8_t(r < 0.f ? 0.f : r > 255.f ? 255.f : r);
+				out[1] = uint8_t(g < 0.f ? 0.f : g > 255.f ? 255.f : g);
+				out[2] = uint8_t(b < 0.f ? 0.f : b > 255.f ? 255.f : b);
+			}
+		}
+		return image;
+	}
+
+	// ---- radiance hdr ----
+
+	ImageData decodeHdr(const uint8_t* data, size_t size) {
+		// header lines until an empty one, then the resolution line
+		size_t position = 0;
+		auto line = [&]() {
+			const size_t begin = position;
+			while (position < size && data[position] != '\n') ++position;
+			std::string result((const char*)data + begin, position - begin);
+			if (position < size) ++position;
+			return result;
+		};
+		std::string text = line();
+		if (text.rfind("#?RADIANCE", 0) != 0 && text.rfind("#?RGBE", 0) != 0) return fail("not a radiance file");
+		while (position < size && !(text = line()).empty())
+			if (text.rfind("FORMAT=", 0) == 0 && text != "FORMAT=32-bit_rle_rgbe") return fail("only rgbe radiance files are supported");
+		char ySign, yAxis, xSign, xAxis;
+		int height = 0, width = 0;
+		text = line();
+		if (sscanf(text.c_str(), "%c%c %d %c%c %d", &ySign, &yAxis, &height, &xSign, &xAxis, &width) != 6 || yAxis != 'Y' || xAxis != 'X' || xSign != '+' || width <= 0 || height <= 0)
+			return fail("unsupported radiance orientation");
+		// a scanline takes at least 4 bytes per 127 texels (run length encoded) or 4 per texel (flat)
+		if (size_t(height) * (4 + size_t(width) / 127 * 8) > size - position) return fail("truncated radiance data");
+
+		ImageData image;
+		image.width = width; image.height = height; image.channels = 3; image.hdr = true;
+		image.texels.resize(size_t(width) * height * 3 * sizeof(float));
+		std::vector<uint8_t> rgbe(size_t(width) * 4);
+		for (int y = 0; y < height; ++y) {
+			if (position + 4 > size) return fail("truncated radiance data");
+			const uint8_t* p = data + position;
+			if (width >= 8 && width < 32768 && p[0] == 2 && p[1] == 2 && ((p[2] << 8) | p[3]) == width) {
+				// adaptive run length encoding, one channel at a time
+				position += 4;
+				for (int c = 0; c < 4; ++c)
+					for (int x = 0; x < width;) {
+						if (position >= size) return fail("truncated radiance data");
+						int count = data[position++];
+						if (count > 128) {
+							count -= 128;
+							if (x + count > width || position >= size) return fail("corrupt radiance data");
+							const uint8_t value = data[position++];
+							for (int i = 0; i < count; ++i) rgbe[size_t(x++) * 4 + c] = value;
+						}
+						else {
+							if (count == 0 || x + count > width || position + count > size) return fail("corrupt radiance data");
+							for (int i = 0; i < count; ++i) rgbe[size_t(x++) * 4 + c] = data[position++];
+						}
+					}
+			}
+			else {
+				if (position + size_t(width) * 4 > size) return fail("truncated radiance data");
+				memcpy(rgbe.data(), p, size_t(width) * 4);
+				position += size_t(width) * 4;
+			}
+			// -Y means the first scanline is the top one; GL wants the bottom one first
+			float* out = (float*)image.texels.data() + size_t(ySign == '-' ? height - 1 - y : y) * width * 3;
+			for (int x = 0; x < width; ++x) {
+				const uint8_t* e = &rgbe[size_t(x) * 4];
+				const float scale = e[3] ? ldexpf(1.f, int(e[3]) - (128 + 8)) : 0.f;
+				for (int c = 0; c < 3; ++c) out[x * 3 + c] = (e[c] + (e[3] ? .5f : 0.f)) * scale;
+			}
+		}
+		return image;
+	}
+
+	// ---- mips ----
+
+	float srgbToLinear(uint8_t value) {
+		static float table[256];
+		static const bool initialized = [] {
+			for (int i = 0; i < 256; ++i) {
+				const float c = i / 255.f;
+				table[i] = c <= .04045f ? c / 12.92f : powf((c + .055f) / 1.055f, 2.4f);
+			}
+			return true;
+		}();
+		(void)initialized;
+		return table[value];
+	}
+
+	uint8_t linearToSrgb(float value) {
+		static uint8_t table[4096];
+		static const bool initialized = [] {
+			for (int i = 0; i < 4096; ++i) {
+				const float c = (i + .5f) / 4096.f;
+				table[i] = uint8_t((c <= .0031308f ? c * 12.92f : 1.055f * powf(c, 1.f / 2.4f) - .055f) * 255.f + .5f);
+			}
+			return true;
+		}();
+		(void)initialized;
+		const int index = int(value * 4096.f);
+		return table[index < 0 ? 0 : index > 4095 ? 4095 : index];
+	}
+
+	int mipCount(int width, int height) {
+		int levels = 1;
+		for (int size = width > height ? width : height; size > 1; size >>= 1) ++levels;
+		return levels;
+	}
+
+	void textureFormat(const ImageData& image, GLenum& internalFormat, GLenum& format, GLenum& type) {
+		if (image.hdr) internalFormat = GL_RGB16F;
+		else if (image.linear) internalFormat = image.channels == 4 ? GL_RGBA8 : GL_RGB8;
+		else internalFormat = image.channels == 4 ? GL_SRGB8_ALPHA8 : GL_SRGB8;
+		format = image.channels == 4 ? GL_RGBA : GL_RGB;
+		type = image.hdr ? GL_FLOAT : GL_UNSIGNED_BYTE;
+	}
+}
+
+void generateMips(ImageData& image) {
+	if (!image) return;
+	image.levels.resize(1);
+	const size_t texelSize = image.texelSize();
+	int width = image.width, height = image.height;
+	size_t total = size_t(width) * height * texelSize;
+	for (int level = 1, w = width, h = height; level < mipCount(width, height); ++level) {
+		w = w > 1 ? w / 2 : 1; h = h > 1 ? h / 2 : 1;
+		total += size_t(w) * h * texelSize;
+	}
+	image.texels.resize(total);
+
+	for (int level = 1; level < mipCount(image.width, image.height); ++level) {
+		const int w = width > 1 ? width / 2 : 1, h = height > 1 ? height / 2 : 1;
+		const size_t source = image.levels.back(), target = source + size_t(width) * height * texelSize;
+		image.levels.push_back(target);
+		// 2x2 box; odd edges just reuse the last row/column
+		for (int y = 0; y < h; ++y)
+			for (int x = 0; x < w; ++x) {
+				const int x0 = 2 * x < width ? 2 * x : width - 1, x1 = 2 * x + 1 < width ? 2 * x + 1 : width - 1;
+				const int y0 = 2 * y < height ? 2 * y : height - 1, y1 = 2 * y + 1 < height ? 2 * y + 1 : height - 1;
+				const size_t taps[4] = { size_t(y0) * width + x0, size_t(y0) * width + x1, size_t(y1) * width + x0, size_t(y1) * width + x1 };
+				const size_t out = size_t(y) * w + x;
+				for (int c = 0; c < image.channels; ++c) {
+					if (image.hdr) {
+						const float* in = (const float*)(image.texels.data() + source);
+						float sum = 0.f;
+						for (size_t t : taps) sum += in[t * 3 + c];
+						((float*)(image.texels.data() + target))[out * 3 + c] = sum * .25f;
+					}
+					else {
+						const uint8_t* in = image.texels.data() + source;
+						uint8_t* result = image.texels.data() + target;
+						if (c == 3 || image.linear) {
+							int sum = 0;
+							for (size_t t : taps) sum += in[t * image.channels + c];
+							result[out * image.channels + c] = uint8_t((sum + 2) / 4);
+						}
+						else {
+							float sum = 0.f;
+							for (size_t t : taps) sum += srgbToLinear(in[t * image.channels + c]);
+							result[out * image.channels + c] = linearToSrgb(sum * .25f);
+						}
+					}
+				}
+			}
+		width = w; height = h;
+	}
+}
+
+ImageData decodeImage(const uint8_t* data, size_t size, bool mips) {
+	ImageData image;
+	if (size >= 8 && !memcmp(data, "\x89PNG\r\n\x1a\n", 8))
+		image = decodePng(data, size);
+	else if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF)
+		image = decodeJpeg(data, size);
+	else if (size >= 2 && data[0] == '#' && data[1] == '?')
+		image = decodeHdr(data, size);
+	else
+		return fail("unknown image format");
+	image.levels = { 0 };
+	if (image && mips)
+		generateMips(image);
+	return image;
+}
+
+ImageData decodeImage(const std::string& path, bool mips) {
+	std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+	if (!file) {
+		printf("decodeImage: couldn't open %s\n", path.c_str());
+		return ImageData();
+	}
+	file.seekg(0, std::ios::end);
+	std::vector<uint8_t> data(size_t(file.tellg()));
+	file.seekg(0);
+	file.read((char*)data.data(), data.size());
+	ImageData image = decodeImage(data.data(), data.size(), mips);
+	if (!image)
+		printf("decodeImage: (while reading %s)\n", path.c_str());
+	return image;
+}
+
+Texture<GL_TEXTURE_2D> uploadImage(const ImageData& image) {
+	Texture<GL_TEXTURE_2D> result;
+	if (!image) return result;
+
+	const int levels = mipCount(image.width, image.height);
+	GLenum internalFormat, format, type;
+	textureFormat(image, internalFormat, format, type);
+	glTextureStorage2D(result, levels, internalFormat, image.width, image.height);
+
+	// stage through a PBO: our copy is a plain memcpy, the transfer into the texture is the driver's to schedule
+	GLuint staging;
+	glCreateBuffers(1, &staging);
+	glNamedBufferStorage(staging, image.texels.size(), nullptr, GL_MAP_WRITE_BIT);
+	void* mapped = glMapNamedBufferRange(staging, 0, image.texels.size(), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	memcpy(mapped, image.texels.data(), image.texels.size());
+	glUnmapNamedBuffer(staging);
+
+	GLint alignment;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging);
+	for (size_t level = 0, w = image.width, h = image.height; level < image.levels.size(); ++level) {
+		glTextureSubImage2D(result, GLint(level), 0, 0, GLsizei(w), GLsizei(h), format, type, (const void*)image.levels[level]);
+		w = w > 1 ? w / 2 : 1; h = h > 1 ? h / 2 : 1;
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	glDeleteBuffers(1, &staging); // the GL keeps it alive until the copies are done
+
+	if (image.levels.size() < size_t(levels))
+		glGenerateTextureMipmap(result);
+	return result;
+}
+
+Texture<GL_TEXTURE_2D> loadImage(const std::string& path, bool cpuMips) {
+	return uploadImage(decodeImage(path, cpuMips));
+}
+
+Texture<GL_TEXTURE_2D> loadImage(const std::wstring& path, bool cpuMips) {
+	return loadImage(std::filesystem::path(path).u8string(), cpuMips);
+}
+
+std::vector<Texture<GL_TEXTURE_2D>> loadImages(const std::vector<std::string>& paths, bool cpuMips, unsigned threads) {
+	std::vector<Texture<GL_TEXTURE_2D>> result(paths.size());
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	if (threads > paths.size()) threads = unsigned(paths.size());
+
+	std::vector<ImageData> decoded(paths.size());
+	std::vector<size_t> finished;
+	std::mutex mutex;
+	std::condition_variable done;
+	std::atomic<size_t> next{ 0 };
+
+	std::vector<std::thread> workers;
+	for (unsigned i = 0; i < threads; ++i)
+		workers.emplace_back([&] {
+			for (size_t index; (index = next++) < paths.size();) {
+				decoded[index] = decodeImage(paths[index], cpuMips);
+				std::lock_guard<std::mutex> lock(mutex);
+				finished.push_back(index);
+				done.notify_one();
+			}
+		});
+
+	// upload in completion order so the GL work overlaps with the decoding still going on
+	for (size_t uploaded = 0; uploaded < paths.size();) {
+		std::vector<size_t> ready;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [&] { return !finished.empty(); });
+			ready.swap(finished);
+		}
+		for (size_t index : ready) {
+			if (decoded[index])
+				result[index] = uploadImage(decoded[index]);
+			decoded[index] = ImageData();
+			++uploaded;
+		}
+	}
+	for (auto& worker : workers)
+		worker.join();
+	return result;
+}
+
+std::map<std::string, Texture<GL_TEXTURE_2D>> loadImageDirectory(const std::string& directory, bool cpuMips, unsigned threads) {
+	std::vector<std::string> paths, names;
+	std::error_code ec;
+	for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::u8path(directory), ec)) {
+		std::string extension = entry.path().extension().u8string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return char(tolower(c)); });
+		if (entry.is_regular_file() && (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".hdr")) {
+			paths.push_back(entry.path().u8string());
+			names.push_back(entry.path().filename().u8string());
+		}
+	}
+	auto textures = loadImages(paths, cpuMips, threads);
+	std::map<std::string, Texture<GL_TEXTURE_2D>> result;
+	for (size_t i = 0; i < paths.size(); ++i)
+		result.emplace(names[i], std::move(textures[i]));
+	return result;
+}
+
+TextureStream::TextureStream(size_t bytesPerFrame, unsigned threads) : bytesPerFrame(bytesPerFrame) {
+	for (unsigned i = 0; i < (threads ? threads : 1); ++i)
+		workers.emplace_back([this] {
+			std::unique_lock<std::mutex> lock(mutex);
+			for (;;) {
+				wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+				if (stopping) return;
+				auto job = std::move(jobs.front());
+				jobs.pop_front();
+				++decoding;
+				lock.unlock();
+				// cpu mips, since the small levels have to exist before the big one is uploaded
+				ImageData image = decodeImage(job.second, true);
+				lock.lock();
+				--decoding;
+				if (image)
+					decoded.push_back(Streaming{ job.first, std::move(image), 0, 0 });
+			}
+		});
+}
+
+TextureStream::~TextureStream() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (auto& worker : workers)
+		worker.join();
+	for (auto& fence : fences)
+		if (fence) glDeleteSync(fence);
+	if (staging) {
+		glUnmapNamedBuffer(staging);
+		glDeleteBuffers(1, &staging);
+	}
+}
+
+Texture<GL_TEXTURE_2D> TextureStream::load(const std::string& path) {
+	// mutable storage on purpose: the same name is redefined to the real size once the data is there
+	Texture<GL_TEXTURE_2D> result;
+	GLint previous;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, result);
+	GLint unpackBuffer;
+	glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8_ALPHA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+	glBindTexture(GL_TEXTURE_2D, previous);
+	glTextureParameteri(result, GL_TEXTURE_MAX_LEVEL, 0);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.emplace_back(result, path);
+	}
+	wake.notify_one();
+	return result;
+}
+
+size_t TextureStream::pending() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return jobs.size() + decoding + decoded.size() + active.size();
+}
+
+void TextureStream::update() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto& streaming : decoded) {
+			streaming.level = mipCount(streaming.image.width, streaming.image.height) - 1;
+			active.push_back(std::move(streaming));
+		}
+		decoded.clear();
+	}
+	if (active.empty()) return;
+
+	if (!staging) {
+		glCreateBuffers(1, &staging);
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glNamedBufferStorage(staging, bytesPerFrame * ringFrames, nullptr, flags);
+		mapped = (uint8_t*)glMapNamedBufferRange(staging, 0, bytesPerFrame * ringFrames, flags);
+	}
+	// the slice we're about to overwrite was handed to the GL ringFrames updates ago; normally long done
+	if (fences[frame]) {
+		glClientWaitSync(fences[frame], GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+		glDeleteSync(fences[frame]);
+		fences[frame] = 0;
+	}
+
+	GLint alignment, unpackBuffer, previous;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	const size_t sliceStart = size_t(frame) * bytesPerFrame;
+	size_t used = 0;
+	while (!active.empty()) {
+		Streaming& s = active.front();
+		// the owner let go of it early
+		if (!glIsTexture(s.texture)) {
+			active.pop_front();
+			continue;
+		}
+		const ImageData& image = s.image;
+		const int width = image.width >> s.level ? image.width >> s.level : 1, height = image.height >> s.level ? image.height >> s.level : 1;
+		const size_t texelSize = image.texelSize(), rowSize = size_t(width) * texelSize;
+		used = (used + 3) & ~size_t(3); // float pixel offsets must be aligned to the type
+		int rows = int((bytesPerFrame > used ? bytesPerFrame - used : 0) / rowSize);
+		if (rows == 0 && used > 0) break;
+		if (rows > height - s.row) rows = height - s.row;
+
+		GLenum internalFormat, format, type;
+		textureFormat(image, internalFormat, format, type);
+		const int levels = mipCount(image.width, image.height);
+		if (s.row == 0) {
+			// each level is defined only when its data starts arriving: levels outside base..max don't affect completeness, and
+			// allocating the whole chain at once would cost a frame spike. the smallest level replaces the placeholder
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			glBindTexture(GL_TEXTURE_2D, s.texture);
+			glTexImage2D(GL_TEXTURE_2D, s.level, internalFormat, width, height, 0, format, type, nullptr);
+			if (s.level == levels - 1) {
+				glTextureParameteri(s.texture, GL_TEXTURE_MAX_LEVEL, levels - 1);
+				glTextureParameteri(s.texture, GL_TEXTURE_BASE_LEVEL, levels - 1);
+			}
+		}
+
+		const uint8_t* source = image.texels.data() + image.levels[s.level] + size_t(s.row) * rowSize;
+		if (rows == 0) {
+			// a single row bigger than the whole budget; send it straight from client memory rather than stall forever
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			glTextureSubImage2D(s.texture, s.level, 0, s.row, width, 1, format, type, source);
+			rows = 1;
+			used = bytesPerFrame;
+		}
+		else {
+			memcpy(mapped + sliceStart + used, source, rows * rowSize);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging);
+			glTextureSubImage2D(s.texture, s.level, 0, s.row, width, rows, format, type, (const void*)(sliceStart + used));
+			used += rows * rowSize;
+		}
+		s.row += rows;
+		if (s.row == height) {
+			glTextureParameteri(s.texture, GL_TEXTURE_BASE_LEVEL, s.level);
+			s.row = 0;
+			if (--s.level < 0)
+				active.pop_front();
+		}
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+	glBindTexture(GL_TEXTURE_2D, previous);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	frame = (frame + 1) % ringFrames;
+}
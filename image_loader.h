@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "gl_helpers.h"
+
+// portable image decoding (png, baseline jpeg, radiance hdr) and texture upload.
+// decoding is plain CPU work and safe to call from any thread; only the upload needs the GL context.
+
+// decoded texels, rows bottom-up like GL expects them
+struct ImageData {
+	int width = 0, height = 0;
+	int channels = 0;				// 3 or 4; gray and gray+alpha are expanded
+	bool hdr = false;				// texels are floats (radiance .hdr), otherwise 8-bit sRGB
+	bool linear = false;			// 8-bit texels that aren't colors (normal maps and such): no sRGB in mips or upload
+	std::vector<uint8_t> texels;	// all mip levels back to back
+	std::vector<size_t> levels;		// byte offset of each level present; just {0} unless mips were generated on the CPU
+
+	size_t texelSize() const { return size_t(channels) * (hdr ? sizeof(float) : 1); }
+	operator bool() const { return width > 0 && height > 0; }
+};
+
+// format is detected from the contents, not the extension. failures print why and return an empty ImageData
+ImageData decodeImage(const std::string& path, bool generateMips = false);
+ImageData decodeImage(const uint8_t* data, size_t size, bool generateMips = false);
+
+// fills in the rest of the mip chain with a box filter (in linear space for sRGB data)
+void generateMips(ImageData& image);
+
+// immutable storage with a full mip chain, uploaded through a PBO; GPU-generated mips unless the image has them already
+Texture<GL_TEXTURE_2D> uploadImage(const ImageData& image);
+
+Texture<GL_TEXTURE_2D> loadImage(const std::string& path, bool cpuMips = false);
+Texture<GL_TEXTURE_2D> loadImage(const std::wstring& path, bool cpuMips = false);
+
+// decodes on worker threads (0: one per core) and uploads on this thread as the images finish; order matches paths
+std::vector<Texture<GL_TEXTURE_2D>> loadImages(const std::vector<std::string>& paths, bool cpuMips = false, unsigned threads = 0);
+// every png/jpg/jpeg/hdr in the directory, keyed by file name
+std::map<std::string, Texture<GL_TEXTURE_2D>> loadImageDirectory(const std::string& directory, bool cpuMips = false, unsigned threads = 0);
+
+// streams textures in without stalling the frame: load() hands out a texture right away (a 1x1 placeholder), worker threads decode,
+// and update() (call once per frame) uploads at most bytesPerFrame through a PBO ring. levels arrive smallest first, so the texture
+// sharpens progressively; GL_TEXTURE_BASE_LEVEL always points at the finest complete level.
+// the texture must outlive its streaming (see pending()), and the stream must be destroyed before the context.
+struct TextureStream {
+	TextureStream(size_t bytesPerFrame = 4 << 20, unsigned threads = 1);
+	~TextureStream();
+
+	Texture<GL_TEXTURE_2D> load(const std::string& path);
+	void update();
+	// textures still waiting for decoding or uploads
+	size_t pending() const;
+
+	uint8_t placeholder[4] = { 128, 128, 128, 255 };
+
+private:
+	struct Streaming {
+		GLuint texture;
+		ImageData image;
+		int level;	// next level to upload, counting down
+		int row;	// rows of it already uploaded
+	};
+	size_t bytesPerFrame;
+	std::vector<std::thread> workers;
+	mutable std::mutex mutex;
+	std::condition_variable wake;
+	bool stopping = false;
+	std::deque<std::pair<GLuint, std::string>> jobs;
+	std::deque<Streaming> decoded, active;
+	size_t decoding = 0;
+
+	// ring of frames in flight, each with its own slice of the staging buffer and a fence
+	static constexpr int ringFrames = 3;
+	GLuint staging = 0;
+	uint8_t* mapped = nullptr;
+	GLsync fences[ringFrames] = {};
+	int frame = 0;
+};
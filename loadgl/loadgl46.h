@@ -1,6 +1,17 @@
 #pragma once
+#ifdef _WIN32
+#include <Windows.h>
+#include <gl/gl.h>
+#else
+#ifndef GL_GLEXT_LEGACY
+#define GL_GLEXT_LEGACY
+#endif
+#include <GL/gl.h>
+#endif
+#include "glext.h"
 int loadgl();
 void unloadgl();
+#ifdef _WIN32
 extern PFNGLDRAWRANGEELEMENTSPROC ptr_glDrawRangeElements; void  glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
 extern PFNGLTEXIMAGE3DPROC ptr_glTexImage3D; void  glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
 extern PFNGLTEXSUBIMAGE3DPROC ptr_glTexSubImage3D; void  glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
@@ -51,6 +62,7 @@ extern PFNGLLOADTRANSPOSEMATRIXFPROC ptr_glLoadTransposeMatrixf; void  glLoadTra
 extern PFNGLLOADTRANSPOSEMATRIXDPROC ptr_glLoadTransposeMatrixd; void  glLoadTransposeMatrixd(const GLdouble *m);
 extern PFNGLMULTTRANSPOSEMATRIXFPROC ptr_glMultTransposeMatrixf; void  glMultTransposeMatrixf(const GLfloat *m);
 extern PFNGLMULTTRANSPOSEMATRIXDPROC ptr_glMultTransposeMatrixd; void  glMultTransposeMatrixd(const GLdouble *m);
+#endif
 extern PFNGLBLENDFUNCSEPARATEPROC ptr_glBlendFuncSeparate; void  glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
 extern PFNGLMULTIDRAWARRAYSPROC ptr_glMultiDrawArrays; void  glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
 extern PFNGLMULTIDRAWELEMENTSPROC ptr_glMultiDrawElements; void  glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
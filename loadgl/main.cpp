@@ -47,6 +47,15 @@ int main(int argc, char* argv[]) {
 
 	std::set<std::string> funcnames;
 
+	// gl.h outside of windows already declares (and libGL exports) everything up to 1.3, so those are only wrapped on windows
+	bool windowsOnly = false;
+	auto setWindowsOnly = [&](bool value) {
+		if (value == windowsOnly) return;
+		for (auto* stream : { &define, &declare, &load_debug })
+			*stream << (value ? "#ifdef _WIN32" : "#endif") << std::endl;
+		windowsOnly = value;
+	};
+
 	while (std::getline(glext, line)) {
 		int start_parse = 0;
 		std::string cur_version = "";
@@ -54,8 +63,10 @@ int main(int argc, char* argv[]) {
 			int major = std::stoi(line.substr(line.rfind("_") - 1, 1)),
 				minor = std::stoi(line.substr(line.rfind("_") + 1, 1));
 
-			if (major * 10 + minor <= maxver)
+			if (major * 10 + minor <= maxver) {
 				start_parse = 1;
+				setWindowsOnly(major * 10 + minor <= 13);
+			}
 			cur_version = "core version " + std::to_string(major) + "." + std::to_string(minor);
 
 		}
@@ -64,6 +75,7 @@ int main(int argc, char* argv[]) {
 			if (std::string::npos != line.find("#ifndef GL_ARB_" + str) || std::string::npos != line.find("#ifndef GL_EXT_" + str) || std::string::npos != line.find("#ifndef GL_KHR_" + str) || std::string::npos != line.find("#ifndef GL_AMD_" + str)) {
 				cur_version = "extension " + str;
 				start_parse = 2;
+				setWindowsOnly(false);
 			}
 
 		if (start_parse) {
@@ -133,8 +145,8 @@ int main(int argc, char* argv[]) {
 							load << "\tptr_" << stripfunc << " = (" << proc << ")wglGetProcAddress(\"" << func << "\");" << std::endl;
 							// ptr_glBlendColor = (PFNGLBLENDCOLORPROC)wglGetProcAddress("glBlendColor");
 							load_check << "\t\t\tptr_" << stripfunc << " == nullptr ||" << std::endl;
-							load_debug << "\tptr_" << stripfunc << " = (" << proc << ")wglGetProcAddress(\"" << func << "\");" << std::endl;
-							load_debug << "\tif(!ptr_" << stripfunc << ") { MessageBox(0, TEXT(\"Couldn't load OpenGL " + cur_version + ", function \\\"" + func + "\\\" is missing.\"), TEXT(\"OpenGL function missing\"), MB_OK); result = -1; }" << std::endl << std::endl;
+							load_debug << "\tptr_" << stripfunc << " = (" << proc << ")getProcAddress(\"" << func << "\");" << std::endl;
+							load_debug << "\tif(!ptr_" << stripfunc << ") { loadError(\"Couldn't load OpenGL " + cur_version + ", function \\\"" + func + "\\\" is missing.\"); result = -1; }" << std::endl << std::endl;
 						}
 					}
 					--inside;
@@ -142,6 +154,8 @@ int main(int argc, char* argv[]) {
 			}
 		}
 	}
+	setWindowsOnly(false);
+
 	load_check << "\t\t\t" << "false ) {" << std::endl << "\t\tMessageBox(0, \"Couldn't load OpenGL " + std::to_string(maxver / 10) + "." + std::to_string(maxver % 10);
 	if (extensions.size() > 0) {
 		if (extensions.size() > 1)
@@ -168,13 +182,32 @@ int main(int argc, char* argv[]) {
 
 	std::ofstream cpp("loadgl" + std::to_string(maxver) + ".cpp");
 	std::ofstream header("loadgl" + std::to_string(maxver) + ".h");
-	header << "#pragma once" << std::endl << "int loadgl();" << std::endl << "void unloadgl();" << std::endl;
+	header << "#pragma once" << std::endl;
+	header << "#ifdef _WIN32" << std::endl;
+	header << "#include <Windows.h>" << std::endl;
+	header << "#include <gl/gl.h>" << std::endl;
+	header << "#else" << std::endl;
+	// keep the system gl.h from pulling in its own glext.h; ours is included right after
+	header << "#ifndef GL_GLEXT_LEGACY" << std::endl;
+	header << "#define GL_GLEXT_LEGACY" << std::endl;
+	header << "#endif" << std::endl;
+	header << "#include <GL/gl.h>" << std::endl;
+	header << "#endif" << std::endl;
+	header << "#include \"glext.h\"" << std::endl;
+	header << "int loadgl();" << std::endl << "void unloadgl();" << std::endl;
 	while (std::getline(define, line))
 		header << line << std::endl;
-	cpp << "#include <Windows.h>" << std::endl;
-	cpp << "#include <gl/gl.h>" << std::endl;
-	cpp << "#include \"glext.h\"" << std::endl;
 	cpp << "#include \"loadgl" + std::to_string(maxver) + ".h\"" << std::endl;
+	// wgl and egl both hand out core and extension functions by name once a context is current
+	cpp << "#ifdef _WIN32" << std::endl;
+	cpp << "#define getProcAddress wglGetProcAddress" << std::endl;
+	cpp << "static void loadError(const char* message) { MessageBoxA(0, message, \"OpenGL function missing\", MB_OK); }" << std::endl;
+	cpp << "#else" << std::endl;
+	cpp << "#include <EGL/egl.h>" << std::endl;
+	cpp << "#include <cstdio>" << std::endl;
+	cpp << "#define getProcAddress eglGetProcAddress" << std::endl;
+	cpp << "static void loadError(const char* message) { std::fprintf(stderr, \"OpenGL function missing: %s\\n\", message); }" << std::endl;
+	cpp << "#endif" << std::endl;
 	while (std::getline(declare, line))
 		cpp << line << std::endl;
 	//cpp << "#ifdef _DEBUG" << std::endl;
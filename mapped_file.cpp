@@ -0,0 +1,82 @@
+#include "mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// both platforms keep the mapping alive through the view, so the handles can be closed right away
+MappedFile::MappedFile(const std::string& path) {
+#ifdef _WIN32
+	HANDLE file = CreateFileW(std::filesystem::u8path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		printf("MappedFile: couldn't open %s\n", path.c_str());
+		return;
+	}
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping) {
+			view = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+		if (view) length = size_t(size.QuadPart);
+		else printf("MappedFile: couldn't map %s\n", path.c_str());
+	}
+	CloseHandle(file);
+#else
+	int file = open(std::filesystem::u8path(path).c_str(), O_RDONLY);
+	if (file < 0) {
+		printf("MappedFile: couldn't open %s\n", path.c_str());
+		return;
+	}
+	struct stat info;
+	if (fstat(file, &info) == 0 && info.st_size > 0) {
+		void* mapped = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		if (mapped != MAP_FAILED) {
+			madvise(mapped, size_t(info.st_size), MADV_SEQUENTIAL);
+			view = (const uint8_t*)mapped;
+			length = size_t(info.st_size);
+		}
+		else printf("MappedFile: couldn't map %s\n", path.c_str());
+	}
+	close(file);
+#endif
+}
+
+MappedFile::~MappedFile() {
+	if (!view) return;
+#ifdef _WIN32
+	UnmapViewOfFile(view);
+#else
+	munmap((void*)view, length);
+#endif
+}
+
+uint64_t hashBytes(const uint8_t* data, size_t size, uint64_t seed) {
+	const uint64_t k0 = 0x9E3779B97F4A7C15ull, k1 = 0xC2B2AE3D27D4EB4Full;
+	uint64_t h = seed ^ (size * k0);
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		uint64_t word;
+		memcpy(&word, data + i, 8);
+		word *= k1; word ^= word >> 31;
+		h = (h ^ word) * k0;
+		h ^= h >> 29;
+	}
+	for (; i < size; ++i)
+		h = (h ^ data[i]) * k1;
+	h ^= h >> 33; h *= k1; h ^= h >> 29;
+	return h;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <utility>
+
+// read-only view of a whole file; the OS pages it in on demand instead of us copying it into a buffer.
+// empty (and false) if the file couldn't be opened or mapped, or has nothing in it.
+struct MappedFile {
+	MappedFile() {}
+	MappedFile(const std::string& path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other) { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) { std::swap(view, other.view); std::swap(length, other.length); return *this; }
+
+	const uint8_t* data() const { return view; }
+	size_t size() const { return length; }
+	operator bool() const { return view != nullptr; }
+
+protected:
+	const uint8_t* view = nullptr;
+	size_t length = 0;
+};
+
+// fast non-cryptographic hash of a byte range; cache keys use it to notice that a source file changed
+uint64_t hashBytes(const uint8_t* data, size_t size, uint64_t seed = 0);
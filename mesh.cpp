@@ -0,0 +1,597 @@
+#include "mesh.h"
+#include "mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace {
+	// by normalized absolute path (and format), so "assets/a.obj" and "./assets/a.obj" are the same mesh
+	std::map<std::string, MeshHandle>& registry() {
+		static std::map<std::string, MeshHandle> meshes;
+		return meshes;
+	}
+
+	// the streams exactly as the buffers hold them
+	struct MeshStreams {
+		std::vector<float> points, uvs, normals;	// vec4, vec2, vec4
+		std::vector<int32_t> faces;					// 3 x ivec4
+		IndexedTriangles triangles;
+		std::vector<Meshlet> meshlets;
+		std::string materialNames;					// "mtllib <file>" and "usemtl <name>" lines, enough to find the materials again
+		std::vector<MeshLod> lods;					// the triangles hold every level back to back
+		QuantizedVertices quantized;
+	};
+
+	// every buffer of a Mesh in one order (the one the cache file uses too), with the size of one element of each
+	// (the material names and the level table stay on the CPU, so they have no buffer)
+	const int streamCount = 16;
+	const size_t elementSizes[streamCount] = { 4 * sizeof(float), 2 * sizeof(float), 4 * sizeof(float), 12 * sizeof(int32_t),
+		4 * sizeof(float), 4 * sizeof(float), 2 * sizeof(float), 3 * sizeof(uint32_t), sizeof(Meshlet), sizeof(uint32_t), 1, sizeof(MeshLod),
+		2 * sizeof(uint32_t), sizeof(uint32_t), sizeof(uint32_t), sizeof(VertexQuantization) };
+
+	std::array<const Buffer*, streamCount> buffers(const Mesh& mesh) {
+		return { &mesh.points, &mesh.uvs, &mesh.normals, &mesh.faces, &mesh.vertexPositions, &mesh.vertexNormals, &mesh.vertexUvs, &mesh.indices, &mesh.meshlets,
+			&mesh.triangleMaterials, nullptr, nullptr, &mesh.quantizedPositions, &mesh.quantizedNormals, &mesh.quantizedUvs, &mesh.quantization };
+	}
+
+	// the vertex streams of the format that isn't used stay out of the GL
+	bool uploaded(int stream, VertexFormat format) {
+		if (stream >= 4 && stream <= 6) return format == VertexFormat::full;
+		if (stream >= 12) return format == VertexFormat::quantized;
+		return true;
+	}
+
+	template<typename T> std::pair<const void*, size_t> view(const std::vector<T>& v) { return { v.data(), v.size() * sizeof(T) }; }
+	std::pair<const void*, size_t> view(const std::string& s) { return { s.data(), s.size() }; }
+	std::pair<const void*, size_t> view(const VertexQuantization& q) { return { &q, sizeof(q) }; }
+
+	std::array<std::pair<const void*, size_t>, streamCount> views(const MeshStreams& streams) {
+		const IndexedTriangles& t = streams.triangles;
+		return { view(streams.points), view(streams.uvs), view(streams.normals), view(streams.faces), view(t.positions), view(t.normals), view(t.uvs), view(t.indices), view(streams.meshlets),
+			view(t.materials), view(streams.materialNames), view(streams.lods),
+			view(streams.quantized.positions), view(streams.quantized.normals), view(streams.quantized.uvs), view(streams.quantized.box) };
+	}
+
+	// xyz to vec4 with w = 1
+	void widen(const std::vector<float>& xyz, float* out) {
+		for (size_t i = 0; i < xyz.size(); i += 3, out += 4) {
+			out[0] = xyz[i]; out[1] = xyz[i + 1]; out[2] = xyz[i + 2]; out[3] = 1.f;
+		}
+	}
+
+	size_t quadCount(const ObjData& obj) {
+		size_t count = 0;
+		for (size_t f = 0; f < obj.faceCount(); ++f)
+			count += obj.faceSize(f) == 4 ? 1 : obj.faceSize(f) - 2;
+		return count;
+	}
+
+	// 12 ints per quad, quadCount(obj) of them
+	void writeQuads(const ObjData& obj, int32_t* face) {
+		const auto addQuad = [&](const ObjCorner& a, const ObjCorner& b, const ObjCorner& c, const ObjCorner& d) {
+			// corners 2 and 3 swap places so the quad reads as a strip
+			const int32_t quad[12] = { a.position, b.position, d.position, c.position, a.texcoord, b.texcoord, d.texcoord, c.texcoord,
+				a.normal, b.normal, d.normal, c.normal };
+			face = std::copy(quad, quad + 12, face);
+		};
+		for (size_t f = 0; f < obj.faceCount(); ++f) {
+			const ObjCorner* c = &obj.corners[obj.faces[f]];
+			const uint32_t size = obj.faceSize(f);
+			if (size == 4)
+				addQuad(c[0], c[1], c[2], c[3]);
+			else
+				for (uint32_t i = 1; i + 1 < size; ++i)
+					addQuad(c[0], c[i], c[i + 1], c[i + 1]);
+		}
+	}
+
+	MeshStreams buildStreams(const ObjData& obj) {
+		MeshStreams streams;
+		streams.points.resize(obj.positions.size() / 3 * 4);
+		widen(obj.positions, streams.points.data());
+		streams.uvs = obj.texcoords;
+		streams.normals.resize(obj.normals.size() / 3 * 4);
+		widen(obj.normals, streams.normals.data());
+		streams.faces.resize(quadCount(obj) * 12);
+		writeQuads(obj, streams.faces.data());
+
+		streams.triangles = weldObj(obj);
+		optimizeVertexCache(streams.triangles);
+		streams.quantized = quantizeVertices(streams.triangles);
+		streams.meshlets = buildMeshlets(streams.triangles);
+
+		// the coarser levels go after the full mesh in the same index stream
+		const std::vector<SimplifiedTriangles> chain = buildLodChain(streams.triangles);
+		IndexedTriangles& t = streams.triangles;
+		streams.lods.push_back({ 0, GLsizei(t.indices.size()), 0.f, 0, 0 });
+		for (const SimplifiedTriangles& level : chain) {
+			streams.lods.push_back({ GLuint(t.indices.size()), GLsizei(level.indices.size()), level.error, 0, 0 });
+			t.indices.insert(t.indices.end(), level.indices.begin(), level.indices.end());
+			t.materials.insert(t.materials.end(), level.materials.begin(), level.materials.end());
+		}
+		for (const std::string& library : obj.materialLibraries)
+			streams.materialNames += "mtllib " + library + "\n";
+		for (const std::string& name : obj.materialNames)
+			streams.materialNames += "usemtl " + name + "\n";
+		return streams;
+	}
+
+	// immutable storage straight from wherever the data is (a vector or a mapped file); GL doesn't take
+	// zero-sized buffers, so missing attributes get a single element
+	void upload(const Buffer& buffer, const void* data, size_t size, size_t element) {
+		glNamedBufferStorage(buffer, size > 0 ? size : element, size > 0 ? data : nullptr, 0);
+	}
+
+	// looks the names up in the mtl files (relative to the obj's directory), packs the materials and turns each run of
+	// same-material triangles into one indirect command. names the libraries don't define get the default material
+	void createMaterials(Mesh& mesh, const uint32_t* triangleMaterials, const std::string& names, const std::filesystem::path& directory) {
+		std::vector<ObjMaterial> defined;
+		for (size_t line = 0, next; line < names.size(); line = next + 1) {
+			next = names.find('\n', line);
+			if (next == std::string::npos || next - line < 7) break;
+			const std::string value = names.substr(line + 7, next - line - 7);
+			if (!names.compare(line, 7, "mtllib ")) {
+				std::vector<ObjMaterial> library = loadMtl((directory / std::filesystem::u8path(value)).u8string());
+				defined.insert(defined.end(), library.begin(), library.end());
+			}
+			else {
+				// the first definition wins, like the libraries were one file
+				const auto found = std::find_if(defined.begin(), defined.end(), [&](const ObjMaterial& m) { return m.name == value; });
+				if (found == defined.end()) {
+					printf("loadMesh: material %s isn't defined\n", value.c_str());
+					mesh.materialInfo.emplace_back().name = value;
+				}
+				else
+					mesh.materialInfo.push_back(*found);
+			}
+		}
+		mesh.materialInfo.emplace_back(); // faces before any usemtl
+
+		const auto texture = [&](const std::string& path) {
+			if (path.empty()) return -1;
+			const auto found = std::find(mesh.textures.begin(), mesh.textures.end(), path);
+			if (found != mesh.textures.end()) return int32_t(found - mesh.textures.begin());
+			mesh.textures.push_back(path);
+			return int32_t(mesh.textures.size() - 1);
+		};
+		std::vector<PackedMaterial> packed;
+		for (const ObjMaterial& m : mesh.materialInfo) {
+			PackedMaterial p;
+			memcpy(p.diffuse, m.diffuse, sizeof(p.diffuse));
+			memcpy(p.specular, m.specular, sizeof(p.specular));
+			memcpy(p.emission, m.emission, sizeof(p.emission));
+			p.opacity = m.opacity;
+			p.shininess = m.shininess;
+			p.illum = m.illum;
+			p.diffuseMap = texture(m.diffuseMap);
+			p.specularMap = texture(m.specularMap);
+			p.bumpMap = texture(m.bumpMap);
+			p.alphaMap = texture(m.alphaMap);
+			packed.push_back(p);
+		}
+		glNamedBufferStorage(mesh.materials, packed.size() * sizeof(PackedMaterial), packed.data(), 0);
+
+		// DrawElementsIndirectCommand; the triangles of each level come grouped by material, so this is one per material that has any
+		struct DrawCommand { GLuint count, instanceCount, firstIndex; GLint baseVertex; GLuint baseInstance; };
+		std::vector<DrawCommand> commands;
+		for (MeshLod& lod : mesh.lods) {
+			const size_t first = commands.size();
+			for (size_t t = lod.firstIndex / 3; t < (lod.firstIndex + lod.indexCount) / 3; ++t) {
+				const uint32_t material = triangleMaterials[t] < packed.size() ? triangleMaterials[t] : uint32_t(packed.size() - 1);
+				if (commands.size() == first || commands.back().baseInstance != material)
+					commands.push_back({ 0, 1, GLuint(t * 3), 0, material });
+				commands.back().count += 3;
+			}
+			std::stable_sort(commands.begin() + first, commands.end(), [&](const DrawCommand& a, const DrawCommand& b) { return packed[a.baseInstance].illum < packed[b.baseInstance].illum; });
+			lod.firstBatch = GLsizei(mesh.batches.size());
+			for (size_t i = first; i < commands.size(); ++i) {
+				const int illum = packed[commands[i].baseInstance].illum;
+				if (mesh.batches.size() == size_t(lod.firstBatch) || mesh.batches.back().illum != illum)
+					mesh.batches.push_back({ illum, GLsizei(i), 0 });
+				++mesh.batches.back().commandCount;
+			}
+			lod.batchCount = GLsizei(mesh.batches.size()) - lod.firstBatch;
+		}
+		upload(mesh.drawCommands, commands.data(), commands.size() * sizeof(DrawCommand), sizeof(DrawCommand));
+	}
+
+	Mesh createMesh(const MeshStreams& streams, const std::filesystem::path& directory, VertexFormat format) {
+		Mesh mesh;
+		mesh.format = format;
+		mesh.quadCount = GLsizei(streams.faces.size() / 12);
+		mesh.lods = streams.lods;
+		mesh.indexCount = mesh.lods[0].indexCount;
+		mesh.meshletCount = GLsizei(streams.meshlets.size());
+		const auto target = buffers(mesh);
+		const auto source = views(streams);
+		for (int i = 0; i < streamCount; ++i)
+			if (target[i])
+				upload(*target[i], source[i].first, uploaded(i, format) ? source[i].second : 0, elementSizes[i]);
+		createMaterials(mesh, streams.triangles.materials.data(), streams.materialNames, directory);
+		return mesh;
+	}
+
+	// <source>.mesh, written next to the source on the first load: this header, then the streams back to back
+	// (16-byte aligned), byte for byte what goes into the buffers. little endian; a different version or source hash means a rebuild
+	const char meshCacheMagic[8] = { 't', 'b', 'm', 'e', 's', 'h', '\r', '\n' };
+	const uint32_t meshCacheVersion = 6;
+
+	struct MeshCacheHeader {
+		char magic[8];
+		uint32_t version;
+		uint32_t quadCount;
+		uint64_t sourceHash;
+		uint64_t offsets[streamCount], sizes[streamCount];
+		uint32_t indexCount; // of all levels
+		uint32_t meshletCount;
+	};
+
+	size_t align16(size_t offset) { return (offset + 15) & ~size_t(15); }
+
+	bool loadCache(const std::string& path, uint64_t sourceHash, const std::filesystem::path& directory, VertexFormat format, Mesh& mesh) {
+		std::error_code ec;
+		if (!std::filesystem::exists(std::filesystem::u8path(path), ec)) return false;
+		MappedFile file(path);
+		if (!file || file.size() < sizeof(MeshCacheHeader)) return false;
+		MeshCacheHeader header;
+		memcpy(&header, file.data(), sizeof(header));
+		if (memcmp(header.magic, meshCacheMagic, 8) || header.version != meshCacheVersion || header.sourceHash != sourceHash)
+			return false;
+		for (int i = 0; i < streamCount; ++i)
+			if (header.offsets[i] > file.size() || header.sizes[i] > file.size() - header.offsets[i] || header.sizes[i] % elementSizes[i])
+				return false;
+		if (header.sizes[3] != uint64_t(header.quadCount) * elementSizes[3] || header.sizes[7] != uint64_t(header.indexCount) * sizeof(uint32_t)
+			|| header.sizes[8] != uint64_t(header.meshletCount) * sizeof(Meshlet) || header.sizes[9] != uint64_t(header.indexCount / 3) * sizeof(uint32_t)
+			|| header.sizes[11] == 0 || header.sizes[15] != sizeof(VertexQuantization))
+			return false;
+		std::vector<MeshLod> lods(size_t(header.sizes[11] / sizeof(MeshLod)));
+		memcpy(lods.data(), file.data() + header.offsets[11], size_t(header.sizes[11]));
+		for (const MeshLod& lod : lods)
+			if (lod.indexCount < 0 || lod.firstIndex % 3 || lod.indexCount % 3 || uint64_t(lod.firstIndex) + uint64_t(lod.indexCount) > header.indexCount)
+				return false;
+
+		// no parsing or conversion: the mapped pages go to the driver as they are
+		const auto target = buffers(mesh);
+		for (int i = 0; i < streamCount; ++i)
+			if (target[i])
+				upload(*target[i], file.data() + header.offsets[i], uploaded(i, format) ? size_t(header.sizes[i]) : 0, elementSizes[i]);
+		mesh.format = format;
+		mesh.quadCount = GLsizei(header.quadCount);
+		mesh.lods = std::move(lods);
+		mesh.indexCount = mesh.lods[0].indexCount;
+		mesh.meshletCount = GLsizei(header.meshletCount);
+		const std::string names((const char*)file.data() + header.offsets[10], size_t(header.sizes[10]));
+		createMaterials(mesh, (const uint32_t*)(file.data() + header.offsets[9]), names, directory);
+		return true;
+	}
+
+	void writeCache(const std::string& path, uint64_t sourceHash, const MeshStreams& streams) {
+		MeshCacheHeader header = {};
+		memcpy(header.magic, meshCacheMagic, 8);
+		header.version = meshCacheVersion;
+		header.quadCount = uint32_t(streams.faces.size() / 12);
+		header.sourceHash = sourceHash;
+		header.indexCount = uint32_t(streams.triangles.indices.size());
+		header.meshletCount = uint32_t(streams.meshlets.size());
+		const auto data = views(streams);
+		for (int i = 0; i < streamCount; ++i)
+			header.sizes[i] = data[i].second;
+		size_t offset = align16(sizeof(header));
+		for (int i = 0; i < streamCount; ++i) {
+			header.offsets[i] = offset;
+			offset = align16(offset + size_t(header.sizes[i]));
+		}
+
+		// written under a temporary name first, so a concurrent run never sees half a file
+		const std::filesystem::path cached = std::filesystem::u8path(path);
+		std::filesystem::path temporary = cached;
+		temporary += ".partial" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+		bool written;
+		{
+			std::ofstream file(temporary, std::ios::binary);
+			const char padding[16] = {};
+			file.write((const char*)&header, sizeof(header));
+			file.write(padding, header.offsets[0] - sizeof(header));
+			for (int i = 0; i < streamCount; ++i) {
+				file.write((const char*)data[i].first, header.sizes[i]);
+				file.write(padding, align16(size_t(header.sizes[i])) - size_t(header.sizes[i]));
+			}
+			written = bool(file);
+		}
+		std::error_code ec;
+		if (written)
+			std::filesystem::rename(temporary, cached, ec);
+		if (!written || ec) {
+			printf("loadMesh: couldn't write %s\n", path.c_str());
+			std::filesystem::remove(temporary, ec);
+		}
+	}
+}
+
+void Mesh::draw() const {
+	bindBuffer("points", points);
+	bindBuffer("uvs", uvs);
+	bindBuffer("normals", normals);
+	bindBuffer("faces", faces);
+	glDrawArrays(GL_TRIANGLES, 0, quadCount * 12);
+}
+
+void Mesh::bindVertices() const {
+	bindBuffer("vertexPositions", vertexPositions);
+	bindBuffer("vertexNormals", vertexNormals);
+	bindBuffer("vertexUvs", vertexUvs);
+	bindBuffer("quantizedPositions", quantizedPositions);
+	bindBuffer("quantizedNormals", quantizedNormals);
+	bindBuffer("quantizedUvs", quantizedUvs);
+	bindBuffer("quantization", quantization);
+	bindBuffer("triangleMaterials", triangleMaterials);
+	bindBuffer("materials", materials);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indices);
+}
+
+void Mesh::drawIndexed(int lod) const {
+	bindVertices();
+	const MeshLod& level = lods[lod];
+	glDrawElements(GL_TRIANGLES, level.indexCount, GL_UNSIGNED_INT, (const void*)(size_t(level.firstIndex) * sizeof(GLuint)));
+}
+
+int Mesh::selectLod(const float cameraToClip[16], float distance, float viewportHeight, float maxPixels) const {
+	// an error e at distance d covers e * cameraToClip[5] / d of the [-1, 1] clip range, half the viewport per unit
+	const float pixelsPerUnit = cameraToClip[5] * viewportHeight * .5f / (distance > 0.f ? distance : 1e-6f);
+	int lod = 0;
+	while (lod + 1 < int(lods.size()) && lods[lod + 1].error * pixelsPerUnit <= maxPixels)
+		++lod;
+	return lod;
+}
+
+void Mesh::drawBatch(const MaterialBatch& batch) const {
+	bindVertices();
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawCommands);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)(size_t(batch.firstCommand) * 5 * sizeof(GLuint)), batch.commandCount, 0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+// mtllib paths are relative to the working directory here, there's no obj path to go by
+Mesh createMesh(const ObjData& obj, VertexFormat format) {
+	return createMesh(buildStreams(obj), std::filesystem::path(), format);
+}
+
+MeshHandle loadMesh(const std::string& path, VertexFormat format) {
+	std::error_code error;
+	std::string key = std::filesystem::absolute(std::filesystem::u8path(path), error).lexically_normal().u8string();
+	if (format == VertexFormat::quantized) key += "|quantized";
+	auto& meshes = registry();
+	const auto found = meshes.find(key);
+	if (found != meshes.end())
+		return found->second;
+
+	// failures aren't remembered, so fixing the file and loading again works
+	MappedFile source(path);
+	if (!source) {
+		printf("loadMesh: couldn't load %s\n", path.c_str());
+		return nullptr;
+	}
+	const uint64_t sourceHash = hashBytes(source.data(), source.size(), meshCacheVersion);
+	const std::string cachePath = path + ".mesh";
+	const std::filesystem::path directory = std::filesystem::u8path(path).parent_path();
+	auto mesh = std::make_shared<Mesh>();
+	if (!loadCache(cachePath, sourceHash, directory, format, *mesh)) {
+		ObjData obj = parseObj((const char*)source.data(), source.size());
+		if (!obj) {
+			printf("loadMesh: (while reading %s)\n", path.c_str());
+			return nullptr;
+		}
+		const MeshStreams streams = buildStreams(obj);
+		obj = ObjData();
+		writeCache(cachePath, sourceHash, streams);
+		*mesh = createMesh(streams, directory, format);
+	}
+	meshes[key] = mesh;
+	return mesh;
+}
+
+Mesh streamMesh(const std::string& path, const std::function<void(uint64_t, uint64_t)>& progress, unsigned threads) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	const auto report = [&](uint64_t done, uint64_t total) { if (progress) progress(done, total); };
+
+	// the scan is the first half of the progress, the upload the second
+	const ObjStream obj(path, 4 << 20, [&](uint64_t done, uint64_t total) { report(done, total * 2); });
+	if (!obj) {
+		printf("streamMesh: couldn't load %s\n", path.c_str());
+		return Mesh();
+	}
+	const ObjPiece& total = obj.total();
+	const auto quadsBefore = [](const ObjPiece& piece) { return piece.corners - 2 * piece.faces - piece.quads; };
+	if (quadsBefore(total) * 12 > uint64_t(INT32_MAX)) {
+		printf("streamMesh: %s has too many faces\n", path.c_str());
+		return Mesh();
+	}
+
+	Mesh mesh;
+	mesh.quadCount = GLsizei(quadsBefore(total));
+	upload(mesh.points, nullptr, total.positions * elementSizes[0], elementSizes[0]);
+	upload(mesh.uvs, nullptr, total.texcoords * elementSizes[1], elementSizes[1]);
+	upload(mesh.normals, nullptr, total.normals * elementSizes[2], elementSizes[2]);
+	upload(mesh.faces, nullptr, size_t(mesh.quadCount) * elementSizes[3], elementSizes[3]);
+
+	// what a piece turns into, stream by stream, and the staging slot that holds the biggest one
+	const size_t pieceCount = obj.pieceCount();
+	const auto sizes = [&](size_t i) {
+		const ObjPiece& a = obj.pieces[i], & b = obj.pieces[i + 1];
+		return std::array<size_t, 4>{ (b.positions - a.positions) * elementSizes[0], (b.texcoords - a.texcoords) * elementSizes[1],
+			(b.normals - a.normals) * elementSizes[2], (quadsBefore(b) - quadsBefore(a)) * elementSizes[3] };
+	};
+	size_t slotSize = 256;
+	for (size_t i = 0; i < pieceCount; ++i) {
+		const auto s = sizes(i);
+		const size_t size = (s[0] + s[1] + s[2] + s[3] + 255) & ~size_t(255);
+		slotSize = size > slotSize ? size : slotSize;
+	}
+
+	// piece i goes to slot i % slotCount: twice the workers, so the GPU can copy out of one half while the other is being filled
+	const size_t slotCount = size_t(threads) * 2;
+	Buffer staging;
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glNamedBufferStorage(staging, slotSize * slotCount, nullptr, flags);
+	uint8_t* mapped = (uint8_t*)glMapNamedBufferRange(staging, 0, slotSize * slotCount, flags);
+	std::vector<GLsync> fences(slotCount, nullptr);
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::deque<size_t> jobs, parsed;
+	bool stopping = false, failed = false;
+	std::vector<std::thread> workers;
+	for (unsigned t = 0; t < threads; ++t)
+		workers.emplace_back([&] {
+			ObjData piece;
+			while (true) {
+				size_t i;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					wake.wait(lock, [&] { return stopping || !jobs.empty(); });
+					if (jobs.empty()) return;
+					i = jobs.front();
+					jobs.pop_front();
+				}
+				const bool ok = obj.read(i, piece);
+				if (ok) {
+					const auto s = sizes(i);
+					uint8_t* slot = mapped + i % slotCount * slotSize;
+					widen(piece.positions, (float*)slot);
+					std::copy(piece.texcoords.begin(), piece.texcoords.end(), (float*)(slot + s[0]));
+					widen(piece.normals, (float*)(slot + s[0] + s[1]));
+					writeQuads(piece, (int32_t*)(slot + s[0] + s[1] + s[2]));
+				}
+				std::lock_guard<std::mutex> lock(mutex);
+				failed |= !ok;
+				parsed.push_back(i);
+				wake.notify_all();
+			}
+		});
+
+	// GL calls stay on this thread: hand out pieces whose slot the GPU is done with, copy out the ones that are parsed
+	std::vector<bool> copied(pieceCount, false);
+	size_t next = 0, inFlight = 0;
+	uint64_t done = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	while (next < pieceCount || inFlight > 0) {
+		while (!failed && next < pieceCount && (next < slotCount || copied[next - slotCount])) {
+			GLsync& fence = fences[next % slotCount];
+			if (fence) {
+				glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+			jobs.push_back(next++);
+			++inFlight;
+			wake.notify_all();
+		}
+		if (failed && inFlight == 0) break;
+		wake.wait(lock, [&] { return !parsed.empty(); });
+		while (!parsed.empty()) {
+			const size_t i = parsed.front();
+			parsed.pop_front();
+			--inFlight;
+			if (failed) continue;
+			const ObjPiece& piece = obj.pieces[i];
+			const auto s = sizes(i);
+			const GLintptr slot = GLintptr(i % slotCount * slotSize);
+			const GLintptr targets[4] = { GLintptr(piece.positions * elementSizes[0]), GLintptr(piece.texcoords * elementSizes[1]),
+				GLintptr(piece.normals * elementSizes[2]), GLintptr(quadsBefore(piece) * elementSizes[3]) };
+			const GLuint buffers[4] = { mesh.points, mesh.uvs, mesh.normals, mesh.faces };
+			for (size_t b = 0, offset = 0; b < 4; offset += s[b], ++b)
+				if (s[b] > 0)
+					glCopyNamedBufferSubData(staging, buffers[b], slot + offset, targets[b], GLsizeiptr(s[b]));
+			fences[i % slotCount] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			copied[i] = true;
+			done += obj.pieces[i + 1].offset - piece.offset;
+			report(total.offset + done, total.offset * 2);
+		}
+	}
+	stopping = true;
+	wake.notify_all();
+	lock.unlock();
+	for (auto& worker : workers) worker.join();
+
+	for (GLsync fence : fences)
+		if (fence) glDeleteSync(fence);
+	glUnmapNamedBuffer(staging);
+	if (failed) {
+		printf("streamMesh: (while reading %s)\n", path.c_str());
+		return Mesh();
+	}
+	return mesh;
+}
+
+void releaseMeshes() {
+	registry().clear();
+}
+
+namespace {
+	// glMultiDrawElementsIndirectCount is core in 4.6, which is the only name the loader resolves (GL_ARB_indirect_parameters' ARB
+	// entry point isn't in it); below that, culled slots are zeroed commands instead
+	bool hasIndirectCount() {
+		static const bool supported = [] {
+			GLint major = 0, minor = 0;
+			glGetIntegerv(GL_MAJOR_VERSION, &major);
+			glGetIntegerv(GL_MINOR_VERSION, &minor);
+			return major > 4 || (major == 4 && minor >= 6);
+		}();
+		return supported;
+	}
+}
+
+void MeshletCuller::cull(const Mesh& mesh, const float toClip[16], const float eye[3]) {
+	if (mesh.meshletCount > capacity) {
+		commands = Buffer(); // immutable storage can't grow, so start over
+		glNamedBufferStorage(commands, sizeof(GLuint) * 5 * mesh.meshletCount, nullptr, 0);
+		capacity = mesh.meshletCount;
+	}
+	const GLuint zero = 0;
+	glClearNamedBufferData(drawCount, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+	if (!hasIndirectCount())
+		glClearNamedBufferData(commands, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+
+	glUseProgram(program);
+	glUniformMatrix4fv("toClip", 1, false, toClip);
+	glUniform3f("eye", eye[0], eye[1], eye[2]);
+	glUniform1ui("meshletCount", GLuint(mesh.meshletCount));
+	bindBuffer("meshlets", mesh.meshlets);
+	bindBuffer("commands", commands);
+	bindBuffer("drawCount", drawCount);
+	glDispatchCompute((GLuint(mesh.meshletCount) + 63) / 64, 1, 1);
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void MeshletCuller::draw(const Mesh& mesh) const {
+	if (mesh.meshletCount == 0 || mesh.meshletCount > capacity) return;
+	mesh.bindVertices();
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands);
+	if (hasIndirectCount()) {
+		glBindBuffer(GL_PARAMETER_BUFFER, drawCount);
+		glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, 0, mesh.meshletCount, 0);
+		glBindBuffer(GL_PARAMETER_BUFFER, 0);
+	}
+	else
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, mesh.meshletCount, 0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+GLuint MeshletCuller::visibleCount() const {
+	GLuint count = 0;
+	if (capacity > 0)
+		glGetNamedBufferSubData(drawCount, 0, sizeof(count), &count);
+	return count;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include "gl_helpers.h"
+#include "obj_loader.h"
+#include "mesh_optimizer.h"
+
+// a mesh that lives on the GPU in immutable buffers, in the layout the quad shaders read by name:
+// points (vec4), uvs (vec2), normals (vec4) and faces (3 x ivec4 per quad: position, uv and normal indices, corners in strip order).
+// the buffers are created once and never touched again, so a Mesh is shared by handle instead of copied.
+// alongside those it keeps welded, indexed triangles (see mesh_optimizer.h) for ordinary vertex shading through the post-transform
+// cache: vertexPositions (vec4), vertexNormals (vec4) and vertexUvs (vec2) are read with gl_VertexID, which drawIndexed() sets from the indices.
+
+// how the welded vertices are stored: full is 40 bytes of floats per vertex; quantized is 16 (quantizedPositions, quantizedNormals,
+// quantizedUvs and the quantization box; see quantizeVertices() in mesh_optimizer.h), which shaders read through
+// #include "quantization.glsl". only the chosen format is uploaded, the other's buffers are left empty
+enum class VertexFormat { full, quantized };
+
+// one .mtl material as the shaders read it (std430); the maps index Mesh::textures, -1 where the material has none
+struct PackedMaterial {
+	float diffuse[3], opacity;
+	float specular[3], shininess;
+	float emission[3];
+	int32_t illum;
+	int32_t diffuseMap, specularMap, bumpMap, alphaMap;
+};
+
+// the draw commands of one illumination model (so one shader), back to back in Mesh::drawCommands
+struct MaterialBatch {
+	int illum;
+	GLsizei firstCommand, commandCount;
+};
+
+// one level of detail: a range of the index buffer over the same vertices (see simplify() in mesh_optimizer.h), and its batches
+struct MeshLod {
+	GLuint firstIndex;
+	GLsizei indexCount;
+	float error;	// roughly how far the surface is from the full mesh, in position units; 0 for the full mesh
+	GLsizei firstBatch, batchCount;
+};
+
+// materials: the obj's usemtl names in order of first use, then a default one for faces before any usemtl. the triangles are grouped
+// by material, so a material is a single indirect command whose baseInstance is its index: a shader finds its material with
+// materials[gl_BaseInstance] (gl_BaseInstanceARB before 4.6), or with triangleMaterials[gl_PrimitiveID] under drawIndexed().
+// the .mtl files are read again on every load, cached or not, so editing them doesn't invalidate anything
+struct Mesh {
+	Buffer points, uvs, normals, faces;
+	GLsizei quadCount = 0;
+	Buffer vertexPositions, vertexNormals, vertexUvs, indices;
+	Buffer quantizedPositions, quantizedNormals, quantizedUvs, quantization;
+	VertexFormat format = VertexFormat::full;
+	GLsizei indexCount = 0; // of the full mesh; the coarser levels follow it in indices
+	std::vector<MeshLod> lods; // full mesh first, then ever coarser
+	Buffer meshlets; // Meshlet structs covering the index buffer, for MeshletCuller
+	GLsizei meshletCount = 0;
+	Buffer triangleMaterials; // uint per triangle, of every level
+	Buffer materials; // PackedMaterial
+	Buffer drawCommands; // DrawElementsIndirectCommand per material, grouped by batch
+	std::vector<ObjMaterial> materialInfo; // what materials was packed from, names included
+	std::vector<std::string> textures; // every map the materials use, once
+	std::vector<MaterialBatch> batches; // by level, then illum
+
+	// binds the four buffers by name to the current program and draws 12 vertices (4 triangles) per quad
+	void draw() const;
+	// binds the vertex buffers of both formats and the material buffers by name, and the indices to the current vertex array
+	void bindVertices() const;
+	// bindVertices(), then draws the triangles of a level.
+	// gl_PrimitiveID starts over with each draw, so triangleMaterials[gl_PrimitiveID] only holds for level 0
+	void drawIndexed(int lod = 0) const;
+	// like drawIndexed(), but only the materials of one batch, in a single multi-draw.
+	// state changes per batch (pick the program for batch.illum, then draw), a material change within it costs nothing
+	void drawBatch(const MaterialBatch& batch) const;
+
+	// the coarsest level whose error stays under maxPixels on screen at the given distance from the camera, for a cameraToClip
+	// from setupProjection() and a viewport viewportHeight pixels tall
+	int selectLod(const float cameraToClip[16], float distance, float viewportHeight, float maxPixels = 1.f) const;
+
+	operator bool() const { return quadCount > 0 || indexCount > 0; }
+};
+
+using MeshHandle = std::shared_ptr<const Mesh>;
+
+// quads are kept as is; triangles and larger polygons are fanned into triangles stored as degenerate quads.
+// the level of detail chain (buildLodChain() in mesh_optimizer.h) is built here too, which is most of the cost of a first load
+Mesh createMesh(const ObjData& obj, VertexFormat format = VertexFormat::full);
+
+// for objs too big to hold in memory (see ObjStream in obj_loader.h): worker threads (threads = 0: one per core) parse pieces of the
+// file straight into a persistently mapped staging ring, which the GPU copies into buffers sized by a first scan of the file, so host
+// memory stays at a few pieces however big the file is. only the quad layout is filled, for draw(): welding, levels and materials need
+// the whole mesh at once. nothing is cached or shared. progress(done, total) runs on this thread, in bytes over both passes.
+// failures print why and return an empty Mesh
+Mesh streamMesh(const std::string& path, const std::function<void(uint64_t, uint64_t)>& progress = nullptr, unsigned threads = 0);
+
+// loads and uploads a mesh the first time a path (and format) is seen, after that hands out the same one; returns null on failure.
+// the parsed result, both vertex formats included, is cached in a binary file next to the source (path + ".mesh") that later runs
+// map and hand to the GL as is, as long as the hash of the source still matches. the registry keeps its meshes until releaseMeshes(), which has to happen
+// while the context still exists
+MeshHandle loadMesh(const std::string& path, VertexFormat format = VertexFormat::full);
+void releaseMeshes();
+
+// GPU-driven drawing of a mesh's meshlets: a compute pass (shaders/meshletCull.glsl) frustum and normal cone culls them every frame
+// and writes the survivors as a compacted indirect command buffer, so only visible clusters reach the vertex stage.
+// one culler can serve any number of meshes, as long as each mesh is drawn right after its own cull().
+struct MeshletCuller {
+	MeshletCuller() : program(createProgram("shaders/meshletCull.glsl")) {
+		glNamedBufferStorage(drawCount, sizeof(GLuint), nullptr, 0);
+	}
+
+	// toClip takes the mesh's positions to clip space and eye is the camera position in the same (object) space.
+	// leaves the culling program bound
+	void cull(const Mesh& mesh, const float toClip[16], const float eye[3]);
+	// draws what the last cull() kept with the current program; the shader reads the same buffers as for Mesh::drawIndexed()
+	void draw(const Mesh& mesh) const;
+
+	// meshlets that survived the last cull(); reads back from the GPU, so it waits for the culling to finish
+	GLuint visibleCount() const;
+
+protected:
+	Program program;
+	Buffer commands, drawCount;
+	GLsizei capacity = 0;
+};
@@ -0,0 +1,793 @@
+#include "mesh_optimizer.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+	// welding is a lookup of corner tuples in an open addressed table of vertex ids
+	inline uint64_t hashCorner(const ObjCorner& c) {
+		uint64_t h = uint32_t(c.position) * 0x9E3779B97F4A7C15ull;
+		h ^= (uint32_t(c.texcoord) + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+		h ^= (uint32_t(c.normal) + 0x85EBCA77C2B2AE63ull) * 0x165667B19E3779F9ull;
+		return h ^ (h >> 31);
+	}
+
+	inline bool sameCorner(const ObjCorner& a, const ObjCorner& b) {
+		return a.position == b.position && a.texcoord == b.texcoord && a.normal == b.normal;
+	}
+
+	// Forsyth's scoring: the three most recently used vertices get a fixed score (the next triangle rarely shares all of them),
+	// the rest of the simulated cache falls off with their age; vertices with few triangles left get a boost so they finish
+	// before they're evicted and leave lonely triangles behind.
+	const int scoreCacheSize = 32;
+	const float cacheDecayPower = 1.5f, lastTriangleScore = .75f;
+	const float valenceBoostScale = 2.f, valenceBoostPower = .5f;
+	const uint32_t none = ~0u;
+
+	struct ScoreTables {
+		float cache[scoreCacheSize];
+		float valence[64];
+		ScoreTables() {
+			for (int i = 0; i < scoreCacheSize; ++i)
+				cache[i] = i < 3 ? lastTriangleScore : powf(1.f - float(i - 3) / float(scoreCacheSize - 3), cacheDecayPower);
+			for (int i = 0; i < 64; ++i)
+				valence[i] = i == 0 ? 0.f : valenceBoostScale * powf(float(i), -valenceBoostPower);
+		}
+	};
+
+	float vertexScore(const ScoreTables& tables, int cachePosition, uint32_t remaining) {
+		if (remaining == 0) return -1.f; // nothing left to draw with this vertex
+		const float valence = remaining < 64 ? tables.valence[remaining] : valenceBoostScale * powf(float(remaining), -valenceBoostPower);
+		return (cachePosition >= 0 ? tables.cache[cachePosition] : 0.f) + valence;
+	}
+}
+
+IndexedTriangles weldObj(const ObjData& obj) {
+	IndexedTriangles mesh;
+	const size_t cornerCount = obj.corners.size();
+
+	size_t tableSize = 16;
+	while (tableSize < cornerCount * 2) tableSize *= 2;
+	std::vector<uint32_t> table(tableSize, none);
+	std::vector<ObjCorner> unique;
+	std::vector<uint32_t> vertexOf(cornerCount);
+	for (size_t i = 0; i < cornerCount; ++i) {
+		const ObjCorner& corner = obj.corners[i];
+		size_t slot = hashCorner(corner) & (tableSize - 1);
+		while (table[slot] != none && !sameCorner(unique[table[slot]], corner))
+			slot = (slot + 1) & (tableSize - 1);
+		if (table[slot] == none) {
+			table[slot] = uint32_t(unique.size());
+			unique.push_back(corner);
+		}
+		vertexOf[i] = table[slot];
+	}
+
+	mesh.positions.resize(unique.size() * 4);
+	mesh.normals.resize(unique.size() * 4);
+	mesh.uvs.resize(unique.size() * 2);
+	for (size_t v = 0; v < unique.size(); ++v) {
+		const ObjCorner& c = unique[v];
+		memcpy(&mesh.positions[v * 4], &obj.positions[size_t(c.position) * 3], 3 * sizeof(float));
+		mesh.positions[v * 4 + 3] = 1.f;
+		if (c.normal >= 0)
+			memcpy(&mesh.normals[v * 4], &obj.normals[size_t(c.normal) * 3], 3 * sizeof(float));
+		if (c.texcoord >= 0)
+			memcpy(&mesh.uvs[v * 2], &obj.texcoords[size_t(c.texcoord) * 2], 2 * sizeof(float));
+	}
+
+	const uint32_t defaultMaterial = uint32_t(obj.materialNames.size());
+	for (size_t f = 0; f < obj.faceCount(); ++f) {
+		const uint32_t first = obj.faces[f];
+		const int32_t material = f < obj.faceMaterials.size() ? obj.faceMaterials[f] : -1;
+		for (uint32_t i = 1; i + 1 < obj.faceSize(f); ++i) {
+			mesh.indices.insert(mesh.indices.end(), { vertexOf[first], vertexOf[first + i], vertexOf[first + i + 1] });
+			mesh.materials.push_back(material < 0 ? defaultMaterial : uint32_t(material));
+		}
+	}
+	return mesh;
+}
+
+void optimizeVertexCache(IndexedTriangles& mesh) {
+	const size_t triangleCount = mesh.triangleCount(), vertexCount = mesh.vertexCount();
+	if (triangleCount == 0) return;
+	const std::vector<uint32_t>& indices = mesh.indices;
+	static const ScoreTables tables;
+
+	// triangles of each vertex; the first remaining[v] entries of its range are the ones not drawn yet
+	std::vector<uint32_t> remaining(vertexCount, 0), offsets(vertexCount + 1, 0), adjacency(indices.size());
+	for (uint32_t i : indices) ++remaining[i];
+	for (size_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + remaining[v];
+	{
+		std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); ++i)
+			adjacency[fill[indices[i]]++] = uint32_t(i / 3);
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> score(vertexCount), triangleScore(triangleCount, 0.f);
+	for (size_t v = 0; v < vertexCount; ++v)
+		score[v] = vertexScore(tables, -1, remaining[v]);
+	for (size_t t = 0; t < triangleCount; ++t)
+		triangleScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+	std::vector<bool> drawn(triangleCount, false);
+
+	std::vector<uint32_t> order, cache, nextCache;
+	order.reserve(triangleCount);
+	cache.reserve(scoreCacheSize + 3);
+	nextCache.reserve(scoreCacheSize + 3);
+	uint32_t best = uint32_t(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+	size_t cursor = 0; // where to look for a fresh start when the cache has nothing left to offer
+
+	while (order.size() < triangleCount) {
+		if (best == none) {
+			while (drawn[cursor]) ++cursor;
+			best = uint32_t(cursor);
+		}
+		order.push_back(best);
+		drawn[best] = true;
+
+		// retire the triangle from its vertices' lists and push them to the front of the cache
+		nextCache.clear();
+		for (int k = 0; k < 3; ++k) {
+			const uint32_t v = indices[best * 3 + k];
+			uint32_t* list = &adjacency[offsets[v]];
+			for (uint32_t i = 0; i < remaining[v]; ++i)
+				if (list[i] == best) {
+					std::swap(list[i], list[remaining[v] - 1]);
+					--remaining[v];
+					break;
+				}
+			if (std::find(nextCache.begin(), nextCache.end(), v) == nextCache.end())
+				nextCache.push_back(v);
+		}
+		for (uint32_t v : cache)
+			if (std::find(nextCache.begin(), nextCache.end(), v) == nextCache.end())
+				nextCache.push_back(v);
+
+		// rescore everything that moved (evicted vertices included) and pass the change on to their triangles
+		for (size_t i = 0; i < nextCache.size(); ++i) {
+			const uint32_t v = nextCache[i];
+			cachePosition[v] = i < size_t(scoreCacheSize) ? int(i) : -1;
+			const float updated = vertexScore(tables, cachePosition[v], remaining[v]);
+			const float delta = updated - score[v];
+			score[v] = updated;
+			for (uint32_t j = 0; j < remaining[v]; ++j)
+				triangleScore[adjacency[offsets[v] + j]] += delta;
+		}
+		if (nextCache.size() > size_t(scoreCacheSize))
+			nextCache.resize(scoreCacheSize);
+		std::swap(cache, nextCache);
+
+		// the next triangle is the best one touching the cache
+		best = none;
+		float bestScore = -1.f;
+		for (uint32_t v : cache)
+			for (uint32_t j = 0; j < remaining[v]; ++j) {
+				const uint32_t t = adjacency[offsets[v] + j];
+				if (triangleScore[t] > bestScore) {
+					bestScore = triangleScore[t];
+					best = t;
+				}
+			}
+	}
+
+	// a material change costs more than a cache miss: group by material, keeping the cache order inside each group
+	if (mesh.materials.size() == triangleCount)
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return mesh.materials[a] < mesh.materials[b]; });
+
+	std::vector<uint32_t> reordered(indices.size()), materials(mesh.materials.size());
+	for (size_t i = 0; i < triangleCount; ++i)
+		memcpy(&reordered[i * 3], &indices[size_t(order[i]) * 3], 3 * sizeof(uint32_t));
+	for (size_t i = 0; i < materials.size(); ++i)
+		materials[i] = mesh.materials[order[i]];
+
+	// vertices in first-use order; anything never referenced goes to the end
+	std::vector<uint32_t> remap(vertexCount, none);
+	uint32_t next = 0;
+	for (uint32_t& i : reordered) {
+		if (remap[i] == none) remap[i] = next++;
+		i = remap[i];
+	}
+	for (uint32_t& r : remap)
+		if (r == none) r = next++;
+	IndexedTriangles result;
+	result.positions.resize(mesh.positions.size());
+	result.normals.resize(mesh.normals.size());
+	result.uvs.resize(mesh.uvs.size());
+	for (size_t v = 0; v < vertexCount; ++v) {
+		memcpy(&result.positions[size_t(remap[v]) * 4], &mesh.positions[v * 4], 4 * sizeof(float));
+		memcpy(&result.normals[size_t(remap[v]) * 4], &mesh.normals[v * 4], 4 * sizeof(float));
+		memcpy(&result.uvs[size_t(remap[v]) * 2], &mesh.uvs[v * 2], 2 * sizeof(float));
+	}
+	result.indices = std::move(reordered);
+	result.materials = std::move(materials);
+	mesh = std::move(result);
+}
+
+float acmr(const std::vector<uint32_t>& indices, size_t vertexCount, unsigned cacheSize) {
+	if (indices.size() < 3) return 0.f;
+	// a vertex is cached while fewer than cacheSize misses have happened since it was loaded
+	std::vector<size_t> loadedAt(vertexCount, 0);
+	size_t misses = 0;
+	for (uint32_t i : indices)
+		if (loadedAt[i] == 0 || misses - loadedAt[i] >= cacheSize)
+			loadedAt[i] = ++misses;
+	return float(misses) / float(indices.size() / 3);
+}
+
+std::vector<Meshlet> buildMeshlets(const IndexedTriangles& mesh, unsigned maxVertices, unsigned maxTriangles) {
+	std::vector<Meshlet> meshlets;
+	const std::vector<uint32_t>& indices = mesh.indices;
+	const float* p = mesh.positions.data();
+
+	const auto bound = [&](uint32_t first, uint32_t end) {
+		Meshlet m = {};
+		m.firstIndex = first;
+		m.indexCount = end - first;
+		m.material = mesh.materials.empty() ? 0 : mesh.materials[first / 3];
+
+		// sphere around the box center; looser than a minimal one by a little, but cheap and stable
+		float low[3] = { p[indices[first] * 4], p[indices[first] * 4 + 1], p[indices[first] * 4 + 2] };
+		float high[3] = { low[0], low[1], low[2] };
+		for (uint32_t i = first; i < end; ++i)
+			for (int k = 0; k < 3; ++k) {
+				const float x = p[indices[i] * 4 + k];
+				low[k] = x < low[k] ? x : low[k];
+				high[k] = x > high[k] ? x : high[k];
+			}
+		float radius2 = 0.f;
+		for (int k = 0; k < 3; ++k) m.center[k] = (low[k] + high[k]) * .5f;
+		for (uint32_t i = first; i < end; ++i) {
+			float d2 = 0.f;
+			for (int k = 0; k < 3; ++k) d2 += (p[indices[i] * 4 + k] - m.center[k]) * (p[indices[i] * 4 + k] - m.center[k]);
+			radius2 = d2 > radius2 ? d2 : radius2;
+		}
+		m.radius = sqrtf(radius2);
+
+		// normal cone: the axis is the average facing, the cutoff comes from the normal furthest from it
+		std::vector<float> normals;
+		float axis[3] = { 0.f, 0.f, 0.f };
+		for (uint32_t i = first; i < end; i += 3) {
+			const float* a = p + indices[i] * 4, * b = p + indices[i + 1] * 4, * c = p + indices[i + 2] * 4;
+			const float e0[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] }, e1[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			float n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+			const float length = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			if (length == 0.f) continue; // degenerate triangles don't face anywhere
+			for (int k = 0; k < 3; ++k) {
+				n[k] /= length;
+				axis[k] += n[k];
+			}
+			normals.insert(normals.end(), n, n + 3);
+		}
+		const float axisLength = sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+		m.coneCutoff = 1.f;
+		if (axisLength > 0.f) {
+			for (int k = 0; k < 3; ++k) m.coneAxis[k] = axis[k] / axisLength;
+			float minimum = 1.f;
+			for (size_t i = 0; i < normals.size(); i += 3) {
+				const float d = normals[i] * m.coneAxis[0] + normals[i + 1] * m.coneAxis[1] + normals[i + 2] * m.coneAxis[2];
+				minimum = d < minimum ? d : minimum;
+			}
+			// a cone wider than ~84 degrees from the axis would rarely cull anything
+			if (minimum > .1f)
+				m.coneCutoff = sqrtf(1.f - minimum * minimum);
+		}
+		meshlets.push_back(m);
+	};
+
+	// greedy: keep adding triangles until one would break a limit. usedBy holds the first index of the cluster that last took a vertex
+	std::vector<uint32_t> usedBy(mesh.vertexCount(), none);
+	const auto newVertices = [&](uint32_t i, uint32_t cluster) {
+		const uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+		return uint32_t(usedBy[a] != cluster) + uint32_t(usedBy[b] != cluster && b != a) + uint32_t(usedBy[c] != cluster && c != a && c != b);
+	};
+	uint32_t first = 0, vertices = 0;
+	for (uint32_t i = 0; i < indices.size(); i += 3) {
+		const bool materialChange = !mesh.materials.empty() && mesh.materials[i / 3] != mesh.materials[first / 3];
+		if (i > first && (materialChange || vertices + newVertices(i, first) > maxVertices || (i - first) / 3 + 1 > maxTriangles)) {
+			bound(first, i);
+			first = i;
+			vertices = 0;
+		}
+		vertices += newVertices(i, first);
+		for (int k = 0; k < 3; ++k) usedBy[indices[i + k]] = first;
+	}
+	if (first < indices.size())
+		bound(first, uint32_t(indices.size()));
+	return meshlets;
+}
+
+namespace {
+	// symmetric 4x4 error quadric of a set of weighted planes; error() divides by the total weight, so it's a mean squared distance
+	struct Quadric {
+		double a[6] = {}, b[3] = {}, c = 0., weight = 0.; // a: xx xy xz yy yz zz
+
+		void addPlane(const double n[3], double d, double w) {
+			a[0] += w * n[0] * n[0]; a[1] += w * n[0] * n[1]; a[2] += w * n[0] * n[2];
+			a[3] += w * n[1] * n[1]; a[4] += w * n[1] * n[2]; a[5] += w * n[2] * n[2];
+			for (int k = 0; k < 3; ++k) b[k] += w * n[k] * d;
+			c += w * d * d;
+			weight += w;
+		}
+		void add(const Quadric& q) {
+			for (int k = 0; k < 6; ++k) a[k] += q.a[k];
+			for (int k = 0; k < 3; ++k) b[k] += q.b[k];
+			c += q.c;
+			weight += q.weight;
+		}
+		double error(const float* p) const {
+			const double x = p[0], y = p[1], z = p[2];
+			const double e = a[0] * x * x + a[3] * y * y + a[5] * z * z + 2. * (a[1] * x * y + a[2] * x * z + a[4] * y * z)
+				+ 2. * (b[0] * x + b[1] * y + b[2] * z) + c;
+			return weight > 0. && e > 0. ? e / weight : 0.;
+		}
+	};
+
+	inline void cross(const float* a, const float* b, const float* c, float* n) {
+		const float e0[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] }, e1[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+		n[0] = e0[1] * e1[2] - e0[2] * e1[1];
+		n[1] = e0[2] * e1[0] - e0[0] * e1[2];
+		n[2] = e0[0] * e1[1] - e0[1] * e1[0];
+	}
+
+	enum VertexKind : uint8_t { interior, border, locked };
+
+	// everything is indexed by vertex, and a position is represented by the first vertex that has it. the per pass state (collapsedTo,
+	// dirty) is shared by the slab threads, which is fine because each only touches positions inside its own slab
+	struct Simplifier {
+		const IndexedTriangles& mesh;
+		std::vector<uint32_t> positionOf;			// vertex -> representative
+		std::vector<uint32_t> wedgeOffsets, wedges;	// the vertices of each representative
+		std::vector<uint8_t> kind;
+		std::vector<uint64_t> borderEdges;			// sorted, smaller representative in the high half
+		std::vector<Quadric> quadrics;
+		std::vector<uint32_t> collapsedTo;
+		std::vector<uint8_t> dirty, frozen;			// frozen: on a slab seam, only while the slabs run
+		float attributeScale = 0.f;
+
+		Simplifier(const IndexedTriangles& mesh) : mesh(mesh) {}
+
+		const float* position(uint32_t v) const { return &mesh.positions[size_t(v) * 4]; }
+
+		float attributeDistance(uint32_t a, uint32_t b) const {
+			const float* na = &mesh.normals[size_t(a) * 4], * nb = &mesh.normals[size_t(b) * 4];
+			const float* ua = &mesh.uvs[size_t(a) * 2], * ub = &mesh.uvs[size_t(b) * 2];
+			float d = 0.f;
+			for (int k = 0; k < 3; ++k) d += (na[k] - nb[k]) * (na[k] - nb[k]);
+			for (int k = 0; k < 2; ++k) d += (ua[k] - ub[k]) * (ua[k] - ub[k]);
+			return d;
+		}
+
+		// the vertex at position `to` that a corner using vertex `from` continues with
+		uint32_t closestWedge(uint32_t from, uint32_t to) const {
+			uint32_t best = to;
+			float bestDistance = 3.4e38f;
+			for (uint32_t i = wedgeOffsets[to]; i < wedgeOffsets[to + 1]; ++i) {
+				const float d = attributeDistance(from, wedges[i]);
+				if (d < bestDistance) {
+					bestDistance = d;
+					best = wedges[i];
+				}
+			}
+			return best;
+		}
+
+		bool isBorderEdge(uint32_t a, uint32_t b) const {
+			const uint64_t key = uint64_t(a < b ? a : b) << 32 | (a < b ? b : a);
+			return std::binary_search(borderEdges.begin(), borderEdges.end(), key);
+		}
+
+		bool canCollapse(uint32_t u, uint32_t v) const {
+			if (kind[u] == locked || frozen[u] || frozen[v]) return false;
+			return kind[u] == interior || (kind[v] != interior && isBorderEdge(u, v));
+		}
+
+		// runs passes of independent collapses over some triangles (vertex index triplets, with the id of each triangle kept alongside)
+		// until there are target of them or nothing is left to collapse; returns the worst error
+		float collapse(std::vector<uint32_t>& indices, std::vector<uint32_t>& ids, size_t target);
+	};
+
+	float Simplifier::collapse(std::vector<uint32_t>& indices, std::vector<uint32_t>& ids, size_t target) {
+		float worst = 0.f;
+		std::vector<uint64_t> incidence, edges;
+		std::vector<uint32_t> ringU, ringV, opposite;
+		struct Candidate { float cost, error; uint32_t u, v; };
+		std::vector<Candidate> candidates;
+
+		while (ids.size() > target) {
+			const size_t triangleCount = ids.size();
+			for (uint32_t i : indices)
+				if (!frozen[positionOf[i]]) {
+					collapsedTo[positionOf[i]] = none;
+					dirty[positionOf[i]] = 0;
+				}
+
+			// triangles of each position: (representative, triangle) pairs sorted, looked up by binary search
+			incidence.clear();
+			for (size_t i = 0; i < indices.size(); ++i)
+				incidence.push_back(uint64_t(positionOf[indices[i]]) << 32 | (i / 3));
+			std::sort(incidence.begin(), incidence.end());
+			const auto trianglesOf = [&](uint32_t r) {
+				const auto first = std::lower_bound(incidence.begin(), incidence.end(), uint64_t(r) << 32);
+				auto last = first;
+				while (last != incidence.end() && (*last >> 32) == r) ++last;
+				return std::make_pair(first, last);
+			};
+
+			// every edge once, in its cheaper direction
+			edges.clear();
+			for (size_t t = 0; t < triangleCount; ++t)
+				for (int k = 0; k < 3; ++k) {
+					const uint32_t a = positionOf[indices[t * 3 + k]], b = positionOf[indices[t * 3 + (k + 1) % 3]];
+					edges.push_back(uint64_t(a < b ? a : b) << 32 | (a < b ? b : a));
+				}
+			std::sort(edges.begin(), edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+			const auto cost = [&](uint32_t u, uint32_t v, Candidate& c) {
+				c.u = u;
+				c.v = v;
+				c.error = float(quadrics[u].error(position(v)));
+				float attributes = 0.f;
+				const uint32_t wedgeCount = wedgeOffsets[u + 1] - wedgeOffsets[u];
+				for (uint32_t i = wedgeOffsets[u]; i < wedgeOffsets[u + 1]; ++i)
+					attributes += attributeDistance(wedges[i], closestWedge(wedges[i], v));
+				c.cost = c.error + attributeScale * attributes / float(wedgeCount);
+			};
+			candidates.clear();
+			for (uint64_t e : edges) {
+				const uint32_t a = uint32_t(e >> 32), b = uint32_t(e);
+				Candidate ab, ba;
+				ab.cost = ba.cost = 3.4e38f;
+				if (canCollapse(a, b)) cost(a, b, ab);
+				if (canCollapse(b, a)) cost(b, a, ba);
+				if (ab.cost < 3.4e38f || ba.cost < 3.4e38f)
+					candidates.push_back(ab.cost <= ba.cost ? ab : ba);
+			}
+			std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.cost < b.cost; });
+
+			// cheapest first; a collapse locks the ring around it for the rest of the pass, so later ones see unchanged neighborhoods.
+			// only the cheaper half is considered, the rest waits for the next pass with updated quadrics
+			size_t removed = 0, collapses = 0;
+			const size_t considered = (candidates.size() + 1) / 2;
+			for (size_t i = 0; i < considered && triangleCount - removed > target; ++i) {
+				const uint32_t u = candidates[i].u, v = candidates[i].v;
+				if (dirty[u] || dirty[v]) continue;
+				const auto aroundU = trianglesOf(u), aroundV = trianglesOf(v);
+
+				// no triangle may flip, and u and v may only share the neighbors across their shared triangles (the link condition)
+				bool valid = true;
+				size_t shared = 0;
+				ringU.clear();
+				ringV.clear();
+				opposite.clear();
+				for (auto t = aroundU.first; t != aroundU.second && valid; ++t) {
+					const uint32_t* corner = &indices[(*t & 0xFFFFFFFFu) * 3];
+					uint32_t r[3];
+					for (int k = 0; k < 3; ++k) {
+						r[k] = positionOf[corner[k]];
+						if (r[k] != u && r[k] != v) ringU.push_back(r[k]);
+					}
+					if (r[0] == v || r[1] == v || r[2] == v) {
+						++shared;
+						opposite.push_back(r[0] ^ r[1] ^ r[2] ^ u ^ v);
+						continue;
+					}
+					float before[3], after[3];
+					const float* p[3] = { position(r[0]), position(r[1]), position(r[2]) };
+					cross(p[0], p[1], p[2], before);
+					for (int k = 0; k < 3; ++k)
+						if (r[k] == u) p[k] = position(v);
+					cross(p[0], p[1], p[2], after);
+					valid = before[0] * after[0] + before[1] * after[1] + before[2] * after[2] > 0.f;
+				}
+				if (!valid) continue;
+				for (auto t = aroundV.first; t != aroundV.second; ++t)
+					for (int k = 0; k < 3; ++k) {
+						const uint32_t r = positionOf[indices[(*t & 0xFFFFFFFFu) * 3 + k]];
+						if (r != v && r != u) ringV.push_back(r);
+					}
+				std::sort(ringU.begin(), ringU.end());
+				ringU.erase(std::unique(ringU.begin(), ringU.end()), ringU.end());
+				std::sort(ringV.begin(), ringV.end());
+				ringV.erase(std::unique(ringV.begin(), ringV.end()), ringV.end());
+				std::sort(opposite.begin(), opposite.end());
+				opposite.erase(std::unique(opposite.begin(), opposite.end()), opposite.end());
+				size_t common = 0;
+				for (uint32_t r : ringU) common += std::binary_search(ringV.begin(), ringV.end(), r);
+				if (common > opposite.size()) continue;
+
+				collapsedTo[u] = v;
+				quadrics[v].add(quadrics[u]);
+				worst = std::max(worst, sqrtf(candidates[i].error));
+				removed += shared;
+				++collapses;
+				dirty[u] = dirty[v] = 1;
+				for (auto t = aroundU.first; t != aroundU.second; ++t)
+					for (int k = 0; k < 3; ++k) {
+						const uint32_t r = positionOf[indices[(*t & 0xFFFFFFFFu) * 3 + k]];
+						if (!frozen[r]) dirty[r] = 1;
+					}
+			}
+			if (collapses == 0) break;
+
+			// move the corners and drop what became degenerate, keeping the triangle order
+			size_t kept = 0;
+			for (size_t t = 0; t < triangleCount; ++t) {
+				uint32_t corner[3];
+				for (int k = 0; k < 3; ++k) {
+					corner[k] = indices[t * 3 + k];
+					const uint32_t to = collapsedTo[positionOf[corner[k]]];
+					if (to != none) corner[k] = closestWedge(corner[k], to);
+				}
+				const uint32_t a = positionOf[corner[0]], b = positionOf[corner[1]], c = positionOf[corner[2]];
+				if (a == b || b == c || a == c) continue;
+				memcpy(&indices[kept * 3], corner, sizeof(corner));
+				ids[kept++] = ids[t];
+			}
+			indices.resize(kept * 3);
+			ids.resize(kept);
+		}
+		return worst;
+	}
+}
+
+SimplifiedTriangles simplify(const IndexedTriangles& mesh, const std::vector<uint32_t>& indices, const std::vector<uint32_t>& materials,
+	size_t targetTriangles, unsigned threads) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	const size_t vertexCount = mesh.vertexCount();
+	const auto materialOf = [&](uint32_t triangle) { return triangle < materials.size() ? materials[triangle] : 0u; };
+	Simplifier s(mesh);
+
+	// positions by their exact coordinates, in an open addressed table like the one weldObj uses for corners
+	s.positionOf.resize(vertexCount);
+	{
+		size_t tableSize = 16;
+		while (tableSize < vertexCount * 2) tableSize *= 2;
+		std::vector<uint32_t> table(tableSize, none);
+		for (uint32_t v = 0; v < vertexCount; ++v) {
+			uint32_t bits[3];
+			memcpy(bits, s.position(v), sizeof(bits));
+			uint64_t h = bits[0] * 0x9E3779B97F4A7C15ull ^ bits[1] * 0xC2B2AE3D27D4EB4Full ^ bits[2] * 0x165667B19E3779F9ull;
+			size_t slot = (h ^ (h >> 31)) & (tableSize - 1);
+			while (table[slot] != none && memcmp(s.position(table[slot]), bits, sizeof(bits)))
+				slot = (slot + 1) & (tableSize - 1);
+			if (table[slot] == none) table[slot] = v;
+			s.positionOf[v] = table[slot];
+		}
+	}
+	s.wedgeOffsets.assign(vertexCount + 1, 0);
+	for (uint32_t v = 0; v < vertexCount; ++v) ++s.wedgeOffsets[s.positionOf[v] + 1];
+	for (size_t v = 0; v < vertexCount; ++v) s.wedgeOffsets[v + 1] += s.wedgeOffsets[v];
+	s.wedges.resize(vertexCount);
+	{
+		std::vector<uint32_t> fill(s.wedgeOffsets.begin(), s.wedgeOffsets.end() - 1);
+		for (uint32_t v = 0; v < vertexCount; ++v) s.wedges[fill[s.positionOf[v]]++] = v;
+	}
+
+	// triangles that are already degenerate by position would only get in the way
+	std::vector<uint32_t> current, ids;
+	for (uint32_t t = 0; t < indices.size() / 3; ++t) {
+		const uint32_t a = s.positionOf[indices[t * 3]], b = s.positionOf[indices[t * 3 + 1]], c = s.positionOf[indices[t * 3 + 2]];
+		if (a == b || b == c || a == c) continue;
+		current.insert(current.end(), { indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2] });
+		ids.push_back(t);
+	}
+	const size_t triangleCount = ids.size();
+
+	// edges used by one triangle are borders; vertices with other than two border edges, on non-manifold edges or between
+	// materials are locked
+	s.kind.assign(vertexCount, interior);
+	{
+		std::vector<uint64_t> edges;
+		edges.reserve(current.size());
+		for (size_t i = 0; i < current.size(); i += 3)
+			for (int k = 0; k < 3; ++k) {
+				const uint32_t a = s.positionOf[current[i + k]], b = s.positionOf[current[i + (k + 1) % 3]];
+				edges.push_back(uint64_t(a < b ? a : b) << 32 | (a < b ? b : a));
+			}
+		std::sort(edges.begin(), edges.end());
+		std::vector<uint8_t> borderCount(vertexCount, 0);
+		for (size_t i = 0, j; i < edges.size(); i = j) {
+			for (j = i + 1; j < edges.size() && edges[j] == edges[i]; ++j);
+			const uint32_t a = uint32_t(edges[i] >> 32), b = uint32_t(edges[i]);
+			if (j - i == 1) {
+				s.borderEdges.push_back(edges[i]);
+				borderCount[a] = borderCount[a] < 3 ? borderCount[a] + 1 : 3;
+				borderCount[b] = borderCount[b] < 3 ? borderCount[b] + 1 : 3;
+			}
+			else if (j - i > 2)
+				s.kind[a] = s.kind[b] = locked;
+		}
+		std::vector<uint32_t> material(vertexCount, none);
+		for (size_t i = 0; i < current.size(); ++i) {
+			const uint32_t r = s.positionOf[current[i]], m = materialOf(ids[i / 3]);
+			if (material[r] == none) material[r] = m;
+			else if (material[r] != m) s.kind[r] = locked;
+		}
+		for (size_t v = 0; v < vertexCount; ++v)
+			if (s.kind[v] != locked && borderCount[v] != 0)
+				s.kind[v] = borderCount[v] == 2 ? border : locked;
+	}
+
+	// area weighted triangle planes, plus heavier planes standing on the borders so the outline doesn't shrink
+	const double borderWeight = 10.;
+	s.quadrics.resize(vertexCount);
+	float low[3] = { 3.4e38f, 3.4e38f, 3.4e38f }, high[3] = { -3.4e38f, -3.4e38f, -3.4e38f };
+	for (size_t i = 0; i < current.size(); i += 3) {
+		uint32_t r[3];
+		const float* p[3];
+		for (int k = 0; k < 3; ++k) {
+			r[k] = s.positionOf[current[i + k]];
+			p[k] = s.position(r[k]);
+			for (int c = 0; c < 3; ++c) {
+				low[c] = p[k][c] < low[c] ? p[k][c] : low[c];
+				high[c] = p[k][c] > high[c] ? p[k][c] : high[c];
+			}
+		}
+		float nf[3];
+		cross(p[0], p[1], p[2], nf);
+		const double length = sqrt(double(nf[0]) * nf[0] + double(nf[1]) * nf[1] + double(nf[2]) * nf[2]);
+		if (length == 0.) continue;
+		const double n[3] = { nf[0] / length, nf[1] / length, nf[2] / length };
+		const double d = -(n[0] * p[0][0] + n[1] * p[0][1] + n[2] * p[0][2]);
+		for (int k = 0; k < 3; ++k) s.quadrics[r[k]].addPlane(n, d, length * .5);
+		for (int k = 0; k < 3; ++k) {
+			const uint32_t a = r[k], b = r[(k + 1) % 3];
+			if (!s.isBorderEdge(a, b)) continue;
+			const double e[3] = { double(p[(k + 1) % 3][0]) - p[k][0], double(p[(k + 1) % 3][1]) - p[k][1], double(p[(k + 1) % 3][2]) - p[k][2] };
+			double m[3] = { e[1] * n[2] - e[2] * n[1], e[2] * n[0] - e[0] * n[2], e[0] * n[1] - e[1] * n[0] };
+			const double edgeLength = sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+			if (edgeLength == 0.) continue;
+			for (int c = 0; c < 3; ++c) m[c] /= edgeLength;
+			const double md = -(m[0] * p[k][0] + m[1] * p[k][1] + m[2] * p[k][2]);
+			s.quadrics[a].addPlane(m, md, borderWeight * edgeLength * edgeLength);
+			s.quadrics[b].addPlane(m, md, borderWeight * edgeLength * edgeLength);
+		}
+	}
+	// attribute differences are weighed like a squared distance of a hundredth of the box diagonal per unit
+	float diagonal = 0.f;
+	for (int c = 0; c < 3; ++c) diagonal += high[c] > low[c] ? (high[c] - low[c]) * (high[c] - low[c]) : 0.f;
+	s.attributeScale = diagonal * 1e-4f;
+	s.collapsedTo.assign(vertexCount, none);
+	s.dirty.assign(vertexCount, 0);
+	s.frozen.assign(vertexCount, 0);
+
+	// slabs of equal triangle counts along the longest axis, each simplified to the same ratio on its own thread
+	float error = 0.f;
+	const size_t slabMinimum = 1 << 14;
+	const size_t slabCount = threads > 1 ? (triangleCount / slabMinimum < threads ? triangleCount / slabMinimum : threads) : 1;
+	if (slabCount > 1 && targetTriangles < triangleCount) {
+		int axis = 0;
+		for (int c = 1; c < 3; ++c)
+			if (high[c] - low[c] > high[axis] - low[axis]) axis = c;
+		std::vector<uint32_t> byPosition(triangleCount);
+		std::vector<float> key(triangleCount);
+		for (uint32_t t = 0; t < triangleCount; ++t) {
+			byPosition[t] = t;
+			key[t] = s.position(current[t * 3])[axis] + s.position(current[t * 3 + 1])[axis] + s.position(current[t * 3 + 2])[axis];
+		}
+		std::sort(byPosition.begin(), byPosition.end(), [&](uint32_t a, uint32_t b) { return key[a] < key[b]; });
+		std::vector<uint32_t> slabOf(triangleCount), owner(vertexCount, none);
+		for (size_t i = 0; i < triangleCount; ++i) slabOf[byPosition[i]] = uint32_t(i * slabCount / triangleCount);
+		for (size_t i = 0; i < current.size(); ++i) {
+			const uint32_t r = s.positionOf[current[i]], slab = slabOf[i / 3];
+			if (owner[r] == none) owner[r] = slab;
+			else if (owner[r] != slab) s.frozen[r] = 1;
+		}
+
+		std::vector<std::vector<uint32_t>> slabIndices(slabCount), slabIds(slabCount);
+		for (uint32_t t = 0; t < triangleCount; ++t) {
+			slabIndices[slabOf[t]].insert(slabIndices[slabOf[t]].end(), { current[t * 3], current[t * 3 + 1], current[t * 3 + 2] });
+			slabIds[slabOf[t]].push_back(t);
+		}
+		std::vector<float> errors(slabCount, 0.f);
+		const auto run = [&](size_t i) { errors[i] = s.collapse(slabIndices[i], slabIds[i], slabIds[i].size() * targetTriangles / triangleCount); };
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < slabCount; ++i) workers.emplace_back(run, i);
+		run(0);
+		for (auto& w : workers) w.join();
+
+		// back together in the original triangle order (the ids here are positions in current)
+		std::vector<uint8_t> kept(triangleCount, 0);
+		for (size_t i = 0; i < slabCount; ++i) {
+			error = errors[i] > error ? errors[i] : error;
+			for (size_t j = 0; j < slabIds[i].size(); ++j) {
+				const uint32_t t = slabIds[i][j];
+				memcpy(&current[size_t(t) * 3], &slabIndices[i][j * 3], 3 * sizeof(uint32_t));
+				kept[t] = 1;
+			}
+		}
+		std::vector<uint32_t> merged, mergedIds;
+		for (uint32_t t = 0; t < triangleCount; ++t)
+			if (kept[t]) {
+				merged.insert(merged.end(), &current[size_t(t) * 3], &current[size_t(t) * 3] + 3);
+				mergedIds.push_back(ids[t]);
+			}
+		current = std::move(merged);
+		ids = std::move(mergedIds);
+		s.frozen.assign(vertexCount, 0);
+	}
+	const float seams = s.collapse(current, ids, targetTriangles);
+
+	SimplifiedTriangles result;
+	result.indices = std::move(current);
+	for (uint32_t t : ids) result.materials.push_back(materialOf(t));
+	result.error = seams > error ? seams : error;
+	return result;
+}
+
+std::vector<SimplifiedTriangles> buildLodChain(const IndexedTriangles& mesh, unsigned threads) {
+	// below a few hundred triangles a level saves less than the draw costs anyway
+	const size_t minimumTriangles = 256;
+	const size_t maximumLevels = 8;
+	std::vector<SimplifiedTriangles> chain;
+	while (chain.size() < maximumLevels) {
+		const std::vector<uint32_t>& indices = chain.empty() ? mesh.indices : chain.back().indices;
+		const std::vector<uint32_t>& materials = chain.empty() ? mesh.materials : chain.back().materials;
+		const size_t triangles = indices.size() / 3;
+		if (triangles < minimumTriangles * 2) break;
+		SimplifiedTriangles level = simplify(mesh, indices, materials, triangles / 2, threads);
+		if (level.indices.size() / 3 > triangles * 3 / 4) break; // stuck on locked borders and seams
+		if (!chain.empty() && chain.back().error > level.error) level.error = chain.back().error;
+		chain.push_back(std::move(level));
+	}
+	return chain;
+}
+
+QuantizedVertices quantizeVertices(const IndexedTriangles& mesh) {
+	QuantizedVertices q = {};
+	const size_t vertexCount = mesh.vertexCount();
+	VertexQuantization& box = q.box;
+	float high[3] = {}, uvHigh[2] = {};
+	for (size_t v = 0; v < vertexCount; ++v) {
+		for (int k = 0; k < 3; ++k) {
+			const float x = mesh.positions[v * 4 + k];
+			box.positionLow[k] = v == 0 || x < box.positionLow[k] ? x : box.positionLow[k];
+			high[k] = v == 0 || x > high[k] ? x : high[k];
+		}
+		for (int k = 0; k < 2; ++k) {
+			const float x = mesh.uvs[v * 2 + k];
+			box.uvLow[k] = v == 0 || x < box.uvLow[k] ? x : box.uvLow[k];
+			uvHigh[k] = v == 0 || x > uvHigh[k] ? x : uvHigh[k];
+		}
+	}
+	// a flat box still needs something to divide by
+	for (int k = 0; k < 3; ++k) box.positionExtent[k] = high[k] > box.positionLow[k] ? high[k] - box.positionLow[k] : 1.f;
+	for (int k = 0; k < 2; ++k) box.uvExtent[k] = uvHigh[k] > box.uvLow[k] ? uvHigh[k] - box.uvLow[k] : 1.f;
+
+	const auto unorm = [](float x, float low, float extent) {
+		const float f = (x - low) / extent;
+		return uint32_t(lroundf((f < 0.f ? 0.f : f > 1.f ? 1.f : f) * 65535.f));
+	};
+	const auto snorm = [](float x) {
+		return uint32_t(uint16_t(int16_t(lroundf((x < -1.f ? -1.f : x > 1.f ? 1.f : x) * 32767.f))));
+	};
+	q.positions.resize(vertexCount * 2);
+	q.normals.resize(vertexCount);
+	q.uvs.resize(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v) {
+		const float* p = &mesh.positions[v * 4];
+		q.positions[v * 2] = unorm(p[0], box.positionLow[0], box.positionExtent[0]) | unorm(p[1], box.positionLow[1], box.positionExtent[1]) << 16;
+		q.positions[v * 2 + 1] = unorm(p[2], box.positionLow[2], box.positionExtent[2]);
+
+		// onto the octahedron |x| + |y| + |z| = 1, with the lower half folded over the upper one
+		const float* n = &mesh.normals[v * 4];
+		const float length = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+		float x = length > 0.f ? n[0] / length : 0.f, y = length > 0.f ? n[1] / length : 0.f;
+		if (length > 0.f && n[2] < 0.f) {
+			const float fx = (1.f - fabsf(y)) * (x >= 0.f ? 1.f : -1.f), fy = (1.f - fabsf(x)) * (y >= 0.f ? 1.f : -1.f);
+			x = fx;
+			y = fy;
+		}
+		q.normals[v] = snorm(x) | snorm(y) << 16;
+
+		const float* uv = &mesh.uvs[v * 2];
+		q.uvs[v] = unorm(uv[0], box.uvLow[0], box.uvExtent[0]) | unorm(uv[1], box.uvLow[1], box.uvExtent[1]) << 16;
+	}
+	return q;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "obj_loader.h"
+
+// turning obj polygons into indexed triangles that shade each vertex once: welding, reordering for the post-transform cache,
+// clustering and simplification. plain CPU work, no GL.
+
+// welded triangles: one vertex per unique (position, texcoord, normal) corner, streams laid out like the shaders read them
+struct IndexedTriangles {
+	std::vector<float> positions;	// vec4, w = 1
+	std::vector<float> normals;		// vec4, zero where the obj didn't have one
+	std::vector<float> uvs;			// vec2, zero where the obj didn't have one
+	std::vector<uint32_t> indices;	// 3 per triangle
+	std::vector<uint32_t> materials;	// per triangle, into the obj's materialNames; faces without a usemtl get materialNames.size()
+
+	size_t vertexCount() const { return positions.size() / 4; }
+	size_t triangleCount() const { return indices.size() / 3; }
+};
+
+// polygons are fanned into triangles; the vertices come out in the order their corners first appear
+IndexedTriangles weldObj(const ObjData& obj);
+
+// reorders triangles so that consecutive ones share vertices (Forsyth's linear-speed vertex cache optimization),
+// then renumbers the vertices in the order the new index stream first uses them so fetches walk memory forwards.
+// triangles end up grouped by material (in material order), so each material is one contiguous range of indices
+void optimizeVertexCache(IndexedTriangles& mesh);
+
+// average cache miss ratio: vertex shader invocations per triangle with a FIFO post-transform cache of the given size.
+// 3 is no reuse at all (what unindexed draws get); a closed, well ordered mesh approaches 0.5
+float acmr(const std::vector<uint32_t>& indices, size_t vertexCount, unsigned cacheSize = 16);
+
+// a cluster of triangles that is culled as a unit: a contiguous range of the index stream with at most 64 vertices and 124 triangles.
+// laid out like the culling shader reads it (std430)
+struct Meshlet {
+	float center[3], radius;		// bounding sphere
+	float coneAxis[3], coneCutoff;	// all triangles face away from an eye where dot(center - eye, axis) >= cutoff * |center - eye| + radius
+	uint32_t firstIndex, indexCount;
+	uint32_t material;
+	uint32_t padding;
+};
+
+// splits the triangles in their current order (so after optimizeVertexCache(), clusters come out compact) and bounds each cluster;
+// a cluster never spans two materials.
+// clusters whose normals spread too wide get a cutoff of 1, which never culls
+std::vector<Meshlet> buildMeshlets(const IndexedTriangles& mesh, unsigned maxVertices = 64, unsigned maxTriangles = 124);
+
+// a coarser version of some triangles that indexes the same vertices, so levels of detail share one set of vertex buffers
+struct SimplifiedTriangles {
+	std::vector<uint32_t> indices;		// 3 per triangle, in the order of the input triangles they came from
+	std::vector<uint32_t> materials;	// per triangle, carried over from the input
+	float error = 0.f;					// how far (rms, in position units) the surface moved, at worst, in any collapse
+};
+
+// quadric error metric simplification (Garland & Heckbert) by half-edge collapses towards targetTriangles. vertices are collapsed by
+// position, so uv and normal seams move together; each corner then takes the vertex of the new position whose normal and uv are
+// closest, and that attribute difference adds to the cost. borders and material boundaries stay put. big meshes are cut into
+// spatial slabs that are simplified on their own threads (threads = 0: one per core) with the slab seams locked, and the seams are
+// finished in one last pass over everything
+SimplifiedTriangles simplify(const IndexedTriangles& mesh, const std::vector<uint32_t>& indices, const std::vector<uint32_t>& materials,
+	size_t targetTriangles, unsigned threads = 0);
+
+// levels of detail below mesh itself: each one about half of the previous, until the simplifier stalls or there's little left.
+// errors are cumulative
+std::vector<SimplifiedTriangles> buildLodChain(const IndexedTriangles& mesh, unsigned threads = 0);
+
+// the box the quantized positions and uvs are fractions of, laid out like shaders/quantization.glsl reads it (std430)
+struct VertexQuantization {
+	float positionLow[4], positionExtent[4];
+	float uvLow[2], uvExtent[2];
+};
+
+// IndexedTriangles' vertices at 16 bytes instead of 40: positions as 16-bit fractions of their bounding box, normals octahedral
+// encoded in two snorm16 and uvs as 16-bit fractions of their own box. a position is off by at most 1/131070 of the box per axis.
+// missing (zero) normals come back as +z
+struct QuantizedVertices {
+	std::vector<uint32_t> positions;	// 2 per vertex: x | y << 16, z
+	std::vector<uint32_t> normals;		// unpackSnorm2x16
+	std::vector<uint32_t> uvs;			// unpackUnorm2x16
+	VertexQuantization box;
+};
+
+QuantizedVertices quantizeVertices(const IndexedTriangles& mesh);
@@ -0,0 +1,463 @@
+#include "obj_loader.h"
+#include "mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+	// what one chunk of lines turned into. indices that were relative in the file are stored relative to the chunk's
+	// first position/texcoord/normal and listed in relative, so the merge only has to shift those
+	struct ObjChunk {
+		std::vector<float> positions, texcoords, normals;
+		std::vector<ObjCorner> corners;
+		std::vector<uint32_t> faces;		// first corner of each face, chunk-local
+		std::vector<uint32_t> relative;		// corner * 3 + attribute
+		std::vector<int32_t> faceMaterials;	// into names; -1 until the chunk's first usemtl (the merge fills in the one still active)
+		std::vector<std::string> names, libraries;
+		int32_t material = -1;
+		const char* error = nullptr;		// start of the first bad line
+		const char* reason = nullptr;
+	};
+
+	inline const char* skipSpaces(const char* p, const char* end) {
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+		return p;
+	}
+
+	inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+	inline std::string trimmed(const char* p, const char* end) {
+		p = skipSpaces(p, end);
+		while (end > p && isSpace(end[-1])) --end;
+		return std::string(p, end);
+	}
+
+	// from_chars is locale independent and doesn't allocate, but it doesn't take a leading '+'
+	inline bool parseFloat(const char*& p, const char* end, float& value) {
+		p = skipSpaces(p, end);
+		if (p < end && *p == '+') ++p;
+		const auto [next, error] = std::from_chars(p, end, value);
+		if (error != std::errc()) return false;
+		p = next;
+		return p == end || isSpace(*p);
+	}
+
+	inline bool parseIndex(const char*& p, const char* end, int32_t& value) {
+		if (p < end && *p == '+') ++p;
+		const auto [next, error] = std::from_chars(p, end, value);
+		if (error != std::errc() || value == 0) return false;
+		p = next;
+		return true;
+	}
+
+	void parseChunk(const char* p, const char* end, ObjChunk& chunk) {
+		const auto fail = [&](const char* line, const char* reason) { chunk.error = line; chunk.reason = reason; };
+
+		while (p < end) {
+			const char* start = p;
+			const char* newline = (const char*)memchr(p, '\n', end - p);
+			const char* line = newline ? newline : end;
+			p = skipSpaces(p, line);
+
+			if (line - p > 2 && p[0] == 'v' && isSpace(p[1])) {
+				float x, y, z;
+				p += 2;
+				if (!parseFloat(p, line, x) || !parseFloat(p, line, y) || !parseFloat(p, line, z))
+					return fail(start, "bad vertex");
+				chunk.positions.insert(chunk.positions.end(), { x, y, z }); // a w or vertex colors may follow; ignored
+			}
+			else if (line - p > 3 && p[0] == 'v' && p[1] == 't' && isSpace(p[2])) {
+				float u, v = 0.f;
+				p += 3;
+				if (!parseFloat(p, line, u))
+					return fail(start, "bad texcoord");
+				if (skipSpaces(p, line) < line && !parseFloat(p, line, v))
+					return fail(start, "bad texcoord");
+				chunk.texcoords.insert(chunk.texcoords.end(), { u, v });
+			}
+			else if (line - p > 3 && p[0] == 'v' && p[1] == 'n' && isSpace(p[2])) {
+				float x, y, z;
+				p += 3;
+				if (!parseFloat(p, line, x) || !parseFloat(p, line, y) || !parseFloat(p, line, z))
+					return fail(start, "bad normal");
+				chunk.normals.insert(chunk.normals.end(), { x, y, z });
+			}
+			else if (line - p > 2 && p[0] == 'f' && isSpace(p[1])) {
+				const size_t counts[3] = { chunk.positions.size() / 3, chunk.texcoords.size() / 2, chunk.normals.size() / 3 };
+				chunk.faces.push_back(uint32_t(chunk.corners.size()));
+				chunk.faceMaterials.push_back(chunk.material);
+				for (p = skipSpaces(p + 2, line); p < line; p = skipSpaces(p, line)) {
+					// v, v/t, v//n or v/t/n
+					int32_t index[3] = { 0, 0, 0 };
+					if (!parseIndex(p, line, index[0]))
+						return fail(start, "bad face");
+					if (p < line && *p == '/') {
+						++p;
+						if (p < line && *p != '/' && !parseIndex(p, line, index[1]))
+							return fail(start, "bad face");
+						if (p < line && *p == '/' && (++p, !parseIndex(p, line, index[2])))
+							return fail(start, "bad face");
+					}
+					if (p < line && !isSpace(*p))
+						return fail(start, "bad face");
+
+					int32_t* resolved = &chunk.corners.emplace_back().position;
+					for (int a = 0; a < 3; ++a) {
+						if (index[a] > 0)
+							resolved[a] = index[a] - 1;
+						else if (index[a] < 0) {
+							resolved[a] = int32_t(counts[a]) + index[a];
+							chunk.relative.push_back(uint32_t(chunk.corners.size() - 1) * 3 + a);
+						}
+					}
+				}
+				if (chunk.corners.size() - chunk.faces.back() < 3)
+					return fail(start, "face with fewer than 3 corners");
+			}
+			else if (line - p > 7 && !memcmp(p, "usemtl", 6) && isSpace(p[6])) {
+				const std::string name = trimmed(p + 7, line);
+				const auto found = std::find(chunk.names.begin(), chunk.names.end(), name);
+				chunk.material = int32_t(found - chunk.names.begin());
+				if (found == chunk.names.end()) chunk.names.push_back(name);
+			}
+			else if (line - p > 7 && !memcmp(p, "mtllib", 6) && isSpace(p[6]))
+				for (p = skipSpaces(p + 7, line); p < line; p = skipSpaces(p, line)) {
+					const char* name = p;
+					while (p < line && !isSpace(*p)) ++p;
+					chunk.libraries.emplace_back(name, p);
+				}
+			// comments, groups, smoothing groups, lines, points...
+
+			p = newline ? newline + 1 : end;
+		}
+	}
+
+	// runs work(i) for i in [0, count) on up to threads threads, this one included
+	template<typename Work>
+	void parallelFor(size_t count, unsigned threads, const Work& work) {
+		std::atomic<size_t> next{ 0 };
+		const auto worker = [&] { for (size_t i; (i = next++) < count;) work(i); };
+		std::vector<std::thread> workers;
+		for (unsigned i = 1; i < threads && i < count; ++i)
+			workers.emplace_back(worker);
+		worker();
+		for (auto& w : workers) w.join();
+	}
+
+	ObjData fail(const char* reason) {
+		printf("parseObj: %s\n", reason);
+		return ObjData();
+	}
+}
+
+ObjData parseObj(const char* text, size_t size, unsigned threads) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+
+	// a few chunks per thread so that uneven lines (faces cost more than vertices) still balance; small files aren't worth splitting
+	const size_t minimumChunk = 1 << 20;
+	size_t chunkCount = threads == 1 ? 1 : size_t(threads) * 4;
+	chunkCount = std::min(chunkCount, size / minimumChunk + 1);
+
+	std::vector<const char*> bounds(chunkCount + 1);
+	bounds[0] = text;
+	bounds[chunkCount] = text + size;
+	for (size_t i = 1; i < chunkCount; ++i) {
+		// each chunk starts right after the newline that ends the line its nominal start falls in
+		const char* p = std::max(text + size * i / chunkCount, bounds[i - 1] + 1);
+		const char* newline = p <= text + size ? (const char*)memchr(p - 1, '\n', text + size - (p - 1)) : nullptr;
+		bounds[i] = newline ? newline + 1 : text + size;
+	}
+
+	std::vector<ObjChunk> chunks(chunkCount);
+	parallelFor(chunkCount, threads, [&](size_t i) { parseChunk(bounds[i], bounds[i + 1], chunks[i]); });
+
+	// where each chunk goes in the merged arrays
+	struct Base { size_t positions = 0, texcoords = 0, normals = 0, corners = 0, faces = 0; };
+	std::vector<Base> bases(chunkCount + 1);
+	for (size_t i = 0; i < chunkCount; ++i) {
+		const ObjChunk& chunk = chunks[i];
+		if (chunk.error) {
+			const size_t line = 1 + std::count(text, chunk.error, '\n');
+			printf("parseObj: %s on line %zu\n", chunk.reason, line);
+			return ObjData();
+		}
+		bases[i + 1].positions = bases[i].positions + chunk.positions.size() / 3;
+		bases[i + 1].texcoords = bases[i].texcoords + chunk.texcoords.size() / 2;
+		bases[i + 1].normals = bases[i].normals + chunk.normals.size() / 3;
+		bases[i + 1].corners = bases[i].corners + chunk.corners.size();
+		bases[i + 1].faces = bases[i].faces + chunk.faces.size();
+	}
+	const Base& total = bases[chunkCount];
+	if (total.positions == 0)
+		return fail("no vertices");
+	if (total.corners > UINT32_MAX || std::max({ total.positions, total.texcoords, total.normals }) > size_t(INT32_MAX))
+		return fail("too large for 32-bit indices");
+
+	ObjData result;
+	result.positions.resize(total.positions * 3);
+	result.texcoords.resize(total.texcoords * 2);
+	result.normals.resize(total.normals * 3);
+	result.corners.resize(total.corners);
+	result.faces.resize(total.faces + 1);
+	result.faces[total.faces] = uint32_t(total.corners);
+	result.faceMaterials.resize(total.faces);
+
+	// material names are few, so they're numbered here in file order; each chunk gets a table from its local numbers
+	std::vector<std::vector<int32_t>> materialRemap(chunkCount);
+	std::vector<int32_t> activeMaterial(chunkCount + 1, -1); // the one in effect where each chunk starts
+	for (size_t i = 0; i < chunkCount; ++i) {
+		for (const std::string& name : chunks[i].names) {
+			const auto found = std::find(result.materialNames.begin(), result.materialNames.end(), name);
+			materialRemap[i].push_back(int32_t(found - result.materialNames.begin()));
+			if (found == result.materialNames.end()) result.materialNames.push_back(name);
+		}
+		activeMaterial[i + 1] = chunks[i].material < 0 ? activeMaterial[i] : materialRemap[i][chunks[i].material];
+		for (std::string& library : chunks[i].libraries)
+			if (std::find(result.materialLibraries.begin(), result.materialLibraries.end(), library) == result.materialLibraries.end())
+				result.materialLibraries.push_back(std::move(library));
+	}
+
+	// copy each chunk into place, shift its relative indices and check every index against the final counts
+	std::atomic<bool> outOfRange{ false };
+	parallelFor(chunkCount, threads, [&](size_t i) {
+		ObjChunk& chunk = chunks[i];
+		const Base& base = bases[i];
+		std::copy(chunk.positions.begin(), chunk.positions.end(), result.positions.begin() + base.positions * 3);
+		std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), result.texcoords.begin() + base.texcoords * 2);
+		std::copy(chunk.normals.begin(), chunk.normals.end(), result.normals.begin() + base.normals * 3);
+		for (size_t f = 0; f < chunk.faces.size(); ++f) {
+			result.faces[base.faces + f] = chunk.faces[f] + uint32_t(base.corners);
+			const int32_t material = chunk.faceMaterials[f];
+			result.faceMaterials[base.faces + f] = material < 0 ? activeMaterial[i] : materialRemap[i][material];
+		}
+
+		const int32_t offsets[3] = { int32_t(base.positions), int32_t(base.texcoords), int32_t(base.normals) };
+		for (uint32_t r : chunk.relative)
+			(&chunk.corners[r / 3].position)[r % 3] += offsets[r % 3];
+		const int32_t limits[3] = { int32_t(total.positions), int32_t(total.texcoords), int32_t(total.normals) };
+		bool bad = false;
+		for (const ObjCorner& c : chunk.corners)
+			bad |= c.position < 0 || c.position >= limits[0] || c.texcoord < -1 || c.texcoord >= limits[1] || c.normal < -1 || c.normal >= limits[2];
+		if (bad) outOfRange = true;
+		std::copy(chunk.corners.begin(), chunk.corners.end(), result.corners.begin() + base.corners);
+
+		chunk = ObjChunk(); // the merged copy is all that's needed from here on
+	});
+	if (outOfRange)
+		return fail("face index out of range");
+	return result;
+}
+
+ObjData loadObj(const std::string& path, unsigned threads) {
+	MappedFile file(path);
+	if (!file) {
+		printf("loadObj: couldn't read %s\n", path.c_str());
+		return ObjData();
+	}
+	ObjData result = parseObj((const char*)file.data(), file.size(), threads);
+	if (!result)
+		printf("loadObj: (while reading %s)\n", path.c_str());
+	return result;
+}
+
+namespace {
+	// what parseChunk() will make of some whole lines, without storing any of it; the tests are the same ones it does.
+	// shortFace is set to the first line with a face of fewer than 3 corners, which parseChunk() would reject
+	void countLines(const char* p, const char* end, ObjPiece& counts, uint64_t& shortFace) {
+		while (p < end) {
+			const char* newline = (const char*)memchr(p, '\n', end - p);
+			const char* line = newline ? newline : end;
+			p = skipSpaces(p, line);
+			++counts.line;
+
+			if (line - p > 2 && p[0] == 'v' && isSpace(p[1]))
+				++counts.positions;
+			else if (line - p > 3 && p[0] == 'v' && p[1] == 't' && isSpace(p[2]))
+				++counts.texcoords;
+			else if (line - p > 3 && p[0] == 'v' && p[1] == 'n' && isSpace(p[2]))
+				++counts.normals;
+			else if (line - p > 2 && p[0] == 'f' && isSpace(p[1])) {
+				uint64_t corners = 0;
+				for (p = skipSpaces(p + 2, line); p < line; p = skipSpaces(p, line)) {
+					while (p < line && !isSpace(*p)) ++p;
+					++corners;
+				}
+				if (corners < 3 && shortFace == 0)
+					shortFace = counts.line;
+				++counts.faces;
+				counts.corners += corners;
+				counts.quads += corners == 4;
+			}
+			p = newline ? newline + 1 : end;
+		}
+	}
+}
+
+ObjStream::ObjStream(const std::string& path, size_t pieceSize, const std::function<void(uint64_t, uint64_t)>& progress) : path(path) {
+	std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+	std::error_code error;
+	const uint64_t size = std::filesystem::file_size(std::filesystem::u8path(path), error);
+	if (!file || error) {
+		printf("ObjStream: couldn't read %s\n", path.c_str());
+		return;
+	}
+
+	// each piece ends with the last newline that fits in the buffer; the partial line after it starts the next one.
+	// a line longer than the buffer grows it
+	std::vector<char> buffer(pieceSize > 0 ? pieceSize : 1);
+	ObjPiece counts;
+	pieces.push_back(counts);
+	size_t carried = 0;
+	uint64_t shortFace = 0;
+	while (true) {
+		file.read(buffer.data() + carried, buffer.size() - carried);
+		const size_t filled = carried + size_t(file.gcount());
+		const bool ended = filled < buffer.size();
+		if (filled == 0) break;
+		const char* text = buffer.data();
+		size_t used = filled;
+		if (!ended) {
+			while (used > 0 && text[used - 1] != '\n') --used;
+			if (used == 0) {
+				carried = filled;
+				buffer.resize(buffer.size() * 2);
+				continue;
+			}
+		}
+		countLines(text, text + used, counts, shortFace);
+		counts.offset += used;
+		pieces.push_back(counts);
+		if (progress) progress(counts.offset, size);
+		if (ended) break;
+		carried = filled - used;
+		memmove(buffer.data(), text + used, carried);
+	}
+	if (file.bad()) {
+		printf("ObjStream: couldn't read %s\n", path.c_str());
+		pieces.clear();
+	}
+	else if (shortFace != 0) {
+		// the quad counts the buffers are sized from would be off
+		printf("ObjStream: face with fewer than 3 corners on line %llu of %s\n", (unsigned long long)shortFace, path.c_str());
+		pieces.clear();
+	}
+	else if (total().positions == 0) {
+		printf("ObjStream: no vertices in %s\n", path.c_str());
+		pieces.clear();
+	}
+	else if (total().corners > UINT32_MAX || std::max({ total().positions, total().texcoords, total().normals }) > uint64_t(INT32_MAX)) {
+		printf("ObjStream: %s is too large for 32-bit indices\n", path.c_str());
+		pieces.clear();
+	}
+}
+
+bool ObjStream::read(size_t piece, ObjData& result) const {
+	const ObjPiece& start = pieces[piece];
+	const ObjPiece& end = pieces[piece + 1];
+	std::vector<char> text(end.offset - start.offset);
+	std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+	file.seekg(std::streamoff(start.offset));
+	if (!file.read(text.data(), std::streamsize(text.size()))) {
+		printf("ObjStream: couldn't read %s\n", path.c_str());
+		return false;
+	}
+
+	ObjChunk chunk;
+	parseChunk(text.data(), text.data() + text.size(), chunk);
+	if (chunk.error) {
+		const uint64_t line = start.line + 1 + std::count((const char*)text.data(), chunk.error, '\n');
+		printf("ObjStream: %s on line %llu of %s\n", chunk.reason, (unsigned long long)line, path.c_str());
+		return false;
+	}
+	// the scan and the parse agree unless the file changed in between
+	if (chunk.positions.size() / 3 != end.positions - start.positions || chunk.texcoords.size() / 2 != end.texcoords - start.texcoords ||
+		chunk.normals.size() / 3 != end.normals - start.normals || chunk.corners.size() != end.corners - start.corners) {
+		printf("ObjStream: %s changed while it was being read\n", path.c_str());
+		return false;
+	}
+
+	const int32_t offsets[3] = { int32_t(start.positions), int32_t(start.texcoords), int32_t(start.normals) };
+	for (uint32_t r : chunk.relative)
+		(&chunk.corners[r / 3].position)[r % 3] += offsets[r % 3];
+	const ObjPiece& all = total();
+	const int64_t limits[3] = { int64_t(all.positions), int64_t(all.texcoords), int64_t(all.normals) };
+	for (const ObjCorner& c : chunk.corners)
+		if (c.position < 0 || c.position >= limits[0] || c.texcoord < -1 || c.texcoord >= limits[1] || c.normal < -1 || c.normal >= limits[2]) {
+			printf("ObjStream: face index out of range in %s\n", path.c_str());
+			return false;
+		}
+
+	result = ObjData();
+	result.positions = std::move(chunk.positions);
+	result.texcoords = std::move(chunk.texcoords);
+	result.normals = std::move(chunk.normals);
+	result.corners = std::move(chunk.corners);
+	result.faces = std::move(chunk.faces);
+	result.faces.push_back(uint32_t(result.corners.size()));
+	result.faceMaterials = std::move(chunk.faceMaterials);
+	result.materialNames = std::move(chunk.names);
+	result.materialLibraries = std::move(chunk.libraries);
+	return true;
+}
+
+std::vector<ObjMaterial> loadMtl(const std::string& path) {
+	std::vector<ObjMaterial> materials;
+	MappedFile file(path);
+	if (!file) {
+		printf("loadMtl: couldn't read %s\n", path.c_str());
+		return materials;
+	}
+	const std::filesystem::path directory = std::filesystem::u8path(path).parent_path();
+	// texture options (-bm 1 and such) come before the file name, so the name is the last word
+	const auto mapPath = [&](const char* p, const char* line) {
+		const char* end = line;
+		while (end > p && isSpace(end[-1])) --end;
+		const char* name = end;
+		while (name > p && !isSpace(name[-1])) --name;
+		return (directory / std::filesystem::u8path(std::string(name, end))).u8string();
+	};
+	const auto keyword = [](const char*& p, const char* line, const char* word) {
+		const size_t length = strlen(word);
+		if (size_t(line - p) <= length || memcmp(p, word, length) || !isSpace(p[length])) return false;
+		p += length;
+		return true;
+	};
+
+	const char* text = (const char*)file.data(), * end = text + file.size();
+	bool opacityGiven = false;
+	for (const char* p = text; p < end;) {
+		const char* newline = (const char*)memchr(p, '\n', end - p);
+		const char* line = newline ? newline : end;
+		p = skipSpaces(p, line);
+		ObjMaterial* m = materials.empty() ? nullptr : &materials.back();
+		float value;
+		if (keyword(p, line, "newmtl")) {
+			materials.emplace_back().name = trimmed(p, line);
+			opacityGiven = false;
+		}
+		else if (!m || p == line || *p == '#') {}
+		else if (keyword(p, line, "Kd")) for (float& c : m->diffuse) parseFloat(p, line, c);
+		else if (keyword(p, line, "Ks")) for (float& c : m->specular) parseFloat(p, line, c);
+		else if (keyword(p, line, "Ke")) for (float& c : m->emission) parseFloat(p, line, c);
+		else if (keyword(p, line, "Ns")) parseFloat(p, line, m->shininess);
+		else if (keyword(p, line, "d")) opacityGiven = parseFloat(p, line, m->opacity);
+		else if (keyword(p, line, "Tr")) {
+			if (!opacityGiven && parseFloat(p, line, value)) m->opacity = 1.f - value;
+		}
+		else if (keyword(p, line, "illum")) m->illum = atoi(std::string(p, line).c_str());
+		else if (keyword(p, line, "map_Kd")) m->diffuseMap = mapPath(p, line);
+		else if (keyword(p, line, "map_Ks")) m->specularMap = mapPath(p, line);
+		else if (keyword(p, line, "map_bump") || keyword(p, line, "map_Bump") || keyword(p, line, "bump")) m->bumpMap = mapPath(p, line);
+		else if (keyword(p, line, "map_d")) m->alphaMap = mapPath(p, line);
+		p = newline ? newline + 1 : end;
+	}
+	return materials;
+}
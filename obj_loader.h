@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+// wavefront .obj geometry (v, vt, vn, f, plus usemtl/mtllib; everything else is skipped) and .mtl materials.
+// the obj is memory mapped and split into line-aligned
+// chunks that worker threads parse on their own; the chunks are merged in file order, so the result doesn't depend on the thread count.
+
+// one polygon corner; indices are 0-based with negative (relative) obj indices already resolved, -1 where the face didn't give one
+struct ObjCorner {
+	int32_t position = -1, texcoord = -1, normal = -1;
+};
+
+struct ObjData {
+	std::vector<float> positions;	// xyz
+	std::vector<float> texcoords;	// uv
+	std::vector<float> normals;		// xyz
+	std::vector<ObjCorner> corners;	// corners of every face back to back
+	std::vector<uint32_t> faces;	// first corner of each face, plus one past the last corner
+	std::vector<int32_t> faceMaterials;			// per face, into materialNames; -1 for faces before the first usemtl
+	std::vector<std::string> materialNames;		// in order of first use
+	std::vector<std::string> materialLibraries;	// mtllib files as written, relative to the obj
+
+	size_t faceCount() const { return faces.empty() ? 0 : faces.size() - 1; }
+	uint32_t faceSize(size_t face) const { return faces[face + 1] - faces[face]; }
+	operator bool() const { return !positions.empty(); }
+};
+
+// threads = 0: one per core. failures print why and return an empty ObjData
+ObjData loadObj(const std::string& path, unsigned threads = 0);
+ObjData parseObj(const char* text, size_t size, unsigned threads = 0);
+
+// where a line-aligned piece of an obj starts: its byte offset and line, and how much of everything came before it
+struct ObjPiece {
+	uint64_t offset = 0, line = 0;
+	uint64_t positions = 0, texcoords = 0, normals = 0, faces = 0, corners = 0;
+	uint64_t quads = 0; // faces with exactly 4 corners
+};
+
+// an obj read a piece at a time, for files too big to hold in memory: the constructor reads the whole file once through a buffer of
+// about pieceSize bytes and only counts what each piece holds, after which any piece can be parsed on its own, from any thread.
+// progress(done, total) is called in bytes as the scan goes. false if the file couldn't be read, has no vertices
+// or has a face of fewer than 3 corners
+struct ObjStream {
+	ObjStream() {}
+	ObjStream(const std::string& path, size_t pieceSize = 4 << 20, const std::function<void(uint64_t, uint64_t)>& progress = nullptr);
+
+	// one piece: its own positions, texcoords and normals (pieces[piece] says where they go in the whole file's), and faces whose
+	// corners already index the whole file's. materials are numbered within the piece. a piece can lack any of these, so failures
+	// print why and return false
+	bool read(size_t piece, ObjData& result) const;
+
+	size_t pieceCount() const { return pieces.empty() ? 0 : pieces.size() - 1; }
+	const ObjPiece& total() const { return pieces.back(); }
+	operator bool() const { return !pieces.empty() && total().positions > 0; }
+
+	std::string path;
+	std::vector<ObjPiece> pieces; // one more than there are pieces: the last one is where the file ends, so it holds the totals
+};
+
+// one newmtl block. maps are paths relative to the working directory (the mtl's own directory already prepended), empty if not given
+struct ObjMaterial {
+	std::string name;
+	float diffuse[3] = { .8f, .8f, .8f };	// Kd
+	float specular[3] = { 0.f, 0.f, 0.f };	// Ks
+	float emission[3] = { 0.f, 0.f, 0.f };	// Ke
+	float shininess = 0.f;					// Ns
+	float opacity = 1.f;					// d, or 1 - Tr
+	int illum = 1;
+	std::string diffuseMap, specularMap, bumpMap, alphaMap; // map_Kd, map_Ks, map_bump (or bump), map_d
+};
+
+std::vector<ObjMaterial> loadMtl(const std::string& path);
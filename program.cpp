@@ -53,19 +53,64 @@ void Program::reloadIfRequired() {
 	}
 }
 
+// pastes in the files of #include "file" lines, looked up next to the including file first and then from the working directory.
+// each file goes in once per shader (so includes can include each other freely), and #line directives keep the compiler's line numbers
+// those of the including file. included holds the files used, so they can be watched for reloading
+std::string expandIncludes(const std::string& source, const std::filesystem::path& directory, std::vector<std::string>& included) {
+	using namespace std;
+	string result;
+	result.reserve(source.size());
+	size_t lineNumber = 1;
+	for (size_t start = 0; start < source.size(); ++lineNumber) {
+		size_t end = source.find('\n', start);
+		if (end == string::npos) end = source.size();
+		const string_view line(source.data() + start, end - start);
+		start = end + 1;
+
+		const size_t directive = line.find_first_not_of(" \t");
+		const size_t open = directive != string_view::npos && line.substr(directive, 8) == "#include" ? line.find('"', directive + 8) : string_view::npos;
+		const size_t close = open != string_view::npos ? line.find('"', open + 1) : string_view::npos;
+		if (close == string_view::npos) {
+			result.append(line);
+			result += '\n';
+			continue;
+		}
+		const filesystem::path name = filesystem::u8path(line.substr(open + 1, close - open - 1));
+		error_code ec;
+		const filesystem::path file = filesystem::exists(directory / name, ec) ? directory / name : name;
+		const string key = file.lexically_normal().generic_u8string();
+		ifstream stream(file);
+		if (!stream)
+			cout << "couldn't open " << key << ", included on line " << lineNumber << "\n";
+		if (!stream || find(included.begin(), included.end(), key) != included.end()) {
+			result += '\n';
+			continue;
+		}
+		included.push_back(key);
+		const string content = string(istreambuf_iterator<char>(stream), istreambuf_iterator<char>());
+		result += "#line 1\n" + expandIncludes(content, file.parent_path(), included) + "\n#line " + to_string(lineNumber + 1) + "\n";
+	}
+	return result;
+}
+
 GLuint Program::createShader(std::string_view path, const GLenum shaderType) {
 	using namespace std;
 
 	// if there are line breaks, this is an inline shader instead of a file. if so, we skip the first line (it contains a name) and compile the rest. otherwise read file as source.
 	const size_t search = path.find('\n');
-	const string source = search != string::npos ? string(path.substr(path.find('\n', search + 1) + 1)) : string(istreambuf_iterator<char>(ifstream(path).rdbuf()), istreambuf_iterator<char>());
-	addPath(search != string::npos ? path.substr(search + 1, path.find('\n', search + 1) - search - 1) : path);
+	const string text = search != string::npos ? string(path.substr(path.find('\n', search + 1) + 1)) : string(istreambuf_iterator<char>(ifstream(string(path)).rdbuf()), istreambuf_iterator<char>());
+	const string_view file = search != string::npos ? path.substr(search + 1, path.find('\n', search + 1) - search - 1) : path;
+	addPath(file);
+	vector<string> included;
+	const string source = expandIncludes(text, filesystem::u8path(file).parent_path(), included);
+	for (const string& include : included)
+		addPath(include);
 
 	const GLuint shader = glCreateShader(shaderType);
 	auto source_ptr = (const GLchar*)source.data();
 	const GLint source_len = GLint(source.length());
 
-	glShaderSourcePrint(shader, 1, &source_ptr, &source_len);
+	glShaderSourcePrint(shader, 1, &source_ptr, &source_len, string(file));
 	glCompileShader(shader);
 
 	// print error log if failed to compile
@@ -75,6 +120,7 @@ GLuint Program::createShader(std::string_view path, const GLenum shaderType) {
 		string log(length + 1, '\0');
 		glGetShaderInfoLog(shader, length + 1, &length, &log[0]);
 		cout << "log of compiling " << getFirstLine(path) << ":\n" << log << "\n";
+		releasePrintfShader(shader);
 		glDeleteShader(shader);
 		return 0;
 	}
@@ -101,7 +147,7 @@ std::string_view extract(std::string_view& str, const char delimiter) {
 	size_t count = str.find_first_of(delimiter);
 	if (count == std::string_view::npos) count = str.length();
 	const std::string_view val = str.substr(0, count);
-	str = str.substr(min(count + 1, str.length()));
+	str = str.substr(count < str.length() ? count + 1 : str.length());
 	return val;
 };
 
@@ -197,7 +243,7 @@ inline std::string getGLSLcode(std::string_view path_or_source) {
 		}
 	};
 
-	auto file = string(istreambuf_iterator<char>(ifstream(path).rdbuf()), istreambuf_iterator<char>());
+	auto file = string(istreambuf_iterator<char>(ifstream(string(path)).rdbuf()), istreambuf_iterator<char>());
 	string parsed = simplifySourceFile(file, true);
 
 	auto searchResult = findMarker(path, parsed, index);
@@ -243,6 +289,7 @@ Program::Program(const std::string_view computePath) {
 	program = glCreateProgram();
 	glAttachShader(program, computeShader);
 	glLinkProgram(program);
+	tagPrintfProgram(program);
 	glDeleteShader(computeShader);
 
 	// print error log if failed to link
@@ -320,10 +367,12 @@ Program::Program(const std::string_view vertexPath, const std::string_view contr
 		glDeleteShader(shader); // deleting here is okay; the shader object is reference-counted with the programs it's attached to
 	}
 	if (!compileOk) {
+		tagPrintfProgram(program); // so that destroying it frees the sites of the shaders that did compile
 		destroy();
 		return;
 	}
 	glLinkProgram(program);
+	tagPrintfProgram(program);
 
 	// print error log if failed to link
 	int success; glGetProgramiv(program, GL_LINK_STATUS, &success);
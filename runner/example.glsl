@@ -0,0 +1,25 @@
+#version 450
+
+// example job for the runner: iterates a logistic map per texel, one step per dispatch
+// run with: runner example.glsl example.txt
+
+layout(local_size_x = 16, local_size_y = 16) in;
+
+layout(r32f) uniform image2D state;
+
+uniform vec2 rateRange;
+uniform int iteration;
+
+void main() {
+	const ivec2 p = ivec2(gl_GlobalInvocationID.xy);
+	const ivec2 size = imageSize(state);
+	if (any(greaterThanEqual(p, size))) return;
+
+	const float rate = mix(rateRange.x, rateRange.y, float(p.x) / float(size.x - 1));
+	float x = iteration == 0 ? .5 : imageLoad(state, p).x;
+	x = rate * x * (1. - x);
+	imageStore(state, p, vec4(x));
+
+	COUNT("steps");
+	HISTOGRAM("x", uint(x * 8.), 8);
+}
@@ -0,0 +1,311 @@
+
+// batch compute runner: runs a compute shader over files listed in a manifest, writes the outputs back to disk
+//
+// usage: runner shader.glsl manifest.txt [-d x y z] [-n iterations] [-q] [-a]
+//
+// the manifest is line based, '#' starts a comment, relative paths are relative to the manifest:
+//   dispatch 64 64 1                                  work group counts (default 1 1 1)
+//   iterations 100                                    how many times to dispatch (default 1)
+//   buffer <name> <in|out|inout> <file> [bytes]       shader storage/uniform block; out needs a size, in is padded to it
+//   image <name> <in|out|inout> <file> <format> <w> <h>  raw texels, formats as in glsl layout qualifiers (rgba32f, r32ui, ...)
+//   texture <name> <file> <format> <w> <h>            same but bound to a sampler, always input
+//   uniform <name> <int|uint|float> <values...>       1 to 4 components
+// if the shader declares "uniform int iteration", it's set to the index of each dispatch.
+// shader printf and COUNT/HISTOGRAM output are printed after the run, along with how long decoding the printf output took;
+// -q decodes it without printing it, -a flips printfSubgroupAggregation() (so that its two allocation paths can be compared).
+// printfAlloc and printfDecode are jobs that measure those
+
+#include "../window.h"
+#include "../gl_helpers.h"
+#include "../gl_timing.h"
+#include "../shaderprintf.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <chrono>
+
+namespace fs = std::filesystem;
+
+struct ImageFormat {
+	GLenum internalFormat, format, type;
+	int texelSize;
+};
+
+// the image formats that have a sensible raw file representation
+const std::map<std::string, ImageFormat> imageFormats = {
+	{ "r32f",    { GL_R32F,    GL_RED,          GL_FLOAT,         4 } },
+	{ "rg32f",   { GL_RG32F,   GL_RG,           GL_FLOAT,         8 } },
+	{ "rgba32f", { GL_RGBA32F, GL_RGBA,         GL_FLOAT,        16 } },
+	{ "r16f",    { GL_R16F,    GL_RED,          GL_HALF_FLOAT,    2 } },
+	{ "rg16f",   { GL_RG16F,   GL_RG,           GL_HALF_FLOAT,    4 } },
+	{ "rgba16f", { GL_RGBA16F, GL_RGBA,         GL_HALF_FLOAT,    8 } },
+	{ "r32ui",   { GL_R32UI,   GL_RED_INTEGER,  GL_UNSIGNED_INT,  4 } },
+	{ "rg32ui",  { GL_RG32UI,  GL_RG_INTEGER,   GL_UNSIGNED_INT,  8 } },
+	{ "rgba32ui",{ GL_RGBA32UI,GL_RGBA_INTEGER, GL_UNSIGNED_INT, 16 } },
+	{ "r32i",    { GL_R32I,    GL_RED_INTEGER,  GL_INT,           4 } },
+	{ "rg32i",   { GL_RG32I,   GL_RG_INTEGER,   GL_INT,           8 } },
+	{ "rgba32i", { GL_RGBA32I, GL_RGBA_INTEGER, GL_INT,          16 } },
+	{ "r8",      { GL_R8,      GL_RED,          GL_UNSIGNED_BYTE, 1 } },
+	{ "rgba8",   { GL_RGBA8,   GL_RGBA,         GL_UNSIGNED_BYTE, 4 } },
+};
+
+enum class Access { in, out, inout };
+
+struct BufferEntry {
+	std::string name, file;
+	Access access;
+	size_t size = 0;
+	Buffer buffer;
+};
+
+struct ImageEntry {
+	std::string name, file;
+	Access access;
+	bool sampled = false;
+	ImageFormat format;
+	int width = 0, height = 0;
+	Texture<GL_TEXTURE_2D> texture;
+};
+
+struct UniformEntry {
+	std::string name, type;
+	std::vector<double> values;
+};
+
+struct Manifest {
+	GLuint groups[3] = { 1, 1, 1 };
+	int iterations = 1;
+	std::vector<BufferEntry> buffers;
+	std::vector<ImageEntry> images;
+	std::vector<UniformEntry> uniforms;
+};
+
+std::string readFile(const std::string& path) {
+	std::ifstream file(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool writeFile(const std::string& path, const std::vector<char>& data) {
+	std::ofstream file(path, std::ios::binary);
+	file.write(data.data(), data.size());
+	return bool(file);
+}
+
+bool parseAccess(const std::string& word, Access& access) {
+	if (word == "in") access = Access::in;
+	else if (word == "out") access = Access::out;
+	else if (word == "inout") access = Access::inout;
+	else return false;
+	return true;
+}
+
+// fills manifest; returns false (after telling why) on the first malformed line
+bool parseManifest(const std::string& path, Manifest& manifest) {
+	std::ifstream file(path);
+	if (!file) {
+		std::cout << "couldn't open manifest " << path << "\n";
+		return false;
+	}
+	const fs::path base = fs::path(path).parent_path();
+	auto resolve = [&](const std::string& name) { return (base / name).string(); };
+
+	std::string line;
+	for (int lineNumber = 1; std::getline(file, line); ++lineNumber) {
+		line = line.substr(0, line.find('#'));
+		std::istringstream words(line);
+		std::string kind;
+		if (!(words >> kind)) continue;
+
+		bool valid = true;
+		if (kind == "dispatch")
+			valid = bool(words >> manifest.groups[0] >> manifest.groups[1] >> manifest.groups[2]);
+		else if (kind == "iterations")
+			valid = bool(words >> manifest.iterations);
+		else if (kind == "buffer") {
+			BufferEntry entry;
+			std::string access;
+			valid = bool(words >> entry.name >> access >> entry.file) && parseAccess(access, entry.access);
+			words >> entry.size;
+			valid = valid && (entry.access != Access::out || entry.size > 0);
+			entry.file = resolve(entry.file);
+			manifest.buffers.push_back(std::move(entry));
+		}
+		else if (kind == "image" || kind == "texture") {
+			ImageEntry entry;
+			std::string access = "in", format;
+			entry.sampled = kind == "texture";
+			valid = bool(words >> entry.name);
+			if (!entry.sampled) valid = valid && bool(words >> access);
+			valid = valid && bool(words >> entry.file >> format >> entry.width >> entry.height) && parseAccess(access, entry.access);
+			valid = valid && imageFormats.count(format) > 0 && entry.width > 0 && entry.height > 0;
+			if (valid) entry.format = imageFormats.at(format);
+			entry.file = resolve(entry.file);
+			manifest.images.push_back(std::move(entry));
+		}
+		else if (kind == "uniform") {
+			UniformEntry entry;
+			valid = bool(words >> entry.name >> entry.type) && (entry.type == "int" || entry.type == "uint" || entry.type == "float");
+			for (double value; words >> value;)
+				entry.values.push_back(value);
+			valid = valid && entry.values.size() >= 1 && entry.values.size() <= 4;
+			manifest.uniforms.push_back(std::move(entry));
+		}
+		else
+			valid = false;
+
+		if (!valid) {
+			std::cout << path << ":" << lineNumber << ": couldn't parse \"" << line << "\"\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+void setUniform(const UniformEntry& uniform) {
+	const GLsizei count = GLsizei(uniform.values.size());
+	if (uniform.type == "float") {
+		std::vector<GLfloat> v(uniform.values.begin(), uniform.values.end());
+		switch (count) { case 1: glUniform1fv(uniform.name, 1, v.data()); break; case 2: glUniform2fv(uniform.name, 1, v.data()); break; case 3: glUniform3fv(uniform.name, 1, v.data()); break; default: glUniform4fv(uniform.name, 1, v.data()); }
+	}
+	else if (uniform.type == "int") {
+		std::vector<GLint> v(uniform.values.begin(), uniform.values.end());
+		switch (count) { case 1: glUniform1iv(uniform.name, 1, v.data()); break; case 2: glUniform2iv(uniform.name, 1, v.data()); break; case 3: glUniform3iv(uniform.name, 1, v.data()); break; default: glUniform4iv(uniform.name, 1, v.data()); }
+	}
+	else {
+		std::vector<GLuint> v(uniform.values.begin(), uniform.values.end());
+		switch (count) { case 1: glUniform1uiv(uniform.name, 1, v.data()); break; case 2: glUniform2uiv(uniform.name, 1, v.data()); break; case 3: glUniform3uiv(uniform.name, 1, v.data()); break; default: glUniform4uiv(uniform.name, 1, v.data()); }
+	}
+}
+
+GLenum imageAccess(Access access) {
+	switch (access) {
+	case Access::in: return GL_READ_ONLY;
+	case Access::out: return GL_WRITE_ONLY;
+	default: return GL_READ_WRITE;
+	}
+}
+
+int main(int argc, char* argv[]) {
+
+	std::vector<std::string> positional;
+	int overrideIterations = -1;
+	bool quiet = false;
+	GLuint overrideGroups[3] = { 0, 0, 0 };
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if (arg == "-d" && i + 3 < argc)
+			for (int j = 0; j < 3; ++j) overrideGroups[j] = GLuint(std::atoi(argv[++i]));
+		else if (arg == "-n" && i + 1 < argc)
+			overrideIterations = std::atoi(argv[++i]);
+		else if (arg == "-q")
+			quiet = true;
+		else if (arg == "-a")
+			printfSubgroupAggregation() = !printfSubgroupAggregation();
+		else
+			positional.push_back(arg);
+	}
+	if (positional.size() != 2) {
+		std::cout << "usage: runner shader.glsl manifest.txt [-d x y z] [-n iterations] [-q] [-a]\n";
+		return 1;
+	}
+
+	// compute only, so the window is never shown. the manifest owns GL objects, so it lives inside the context
+	OpenGL context(1, 1, "runner", false, false);
+	if (!glOpen()) return 1;
+
+	Manifest manifest;
+	if (!parseManifest(positional[1], manifest)) return 1;
+	if (overrideIterations >= 0) manifest.iterations = overrideIterations;
+	if (overrideGroups[0] > 0)
+		for (int j = 0; j < 3; ++j) manifest.groups[j] = overrideGroups[j];
+
+	Program program = createProgram(positional[0]);
+	if (!program) return 1;
+	glUseProgram(program);
+
+	// upload inputs; outputs are just allocated
+	for (auto& entry : manifest.buffers) {
+		std::string data;
+		if (entry.access != Access::out) {
+			if (!fs::exists(entry.file)) {
+				std::cout << "input " << entry.file << " for buffer " << entry.name << " doesn't exist\n";
+				return 1;
+			}
+			data = readFile(entry.file);
+		}
+		if (entry.size < data.size()) entry.size = data.size();
+		data.resize(entry.size, '\0');
+		glNamedBufferData(entry.buffer, entry.size, data.data(), GL_DYNAMIC_COPY);
+		bindBuffer(entry.name, entry.buffer);
+	}
+	for (auto& entry : manifest.images) {
+		glTextureStorage2D(entry.texture, 1, entry.format.internalFormat, entry.width, entry.height);
+		const size_t size = size_t(entry.width) * entry.height * entry.format.texelSize;
+		if (entry.access != Access::out) {
+			std::string data = readFile(entry.file);
+			if (data.size() < size) {
+				std::cout << "input " << entry.file << " for image " << entry.name << " has " << data.size() << " bytes, expected " << size << "\n";
+				return 1;
+			}
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTextureSubImage2D(entry.texture, 0, 0, 0, entry.width, entry.height, entry.format.format, entry.format.type, data.data());
+		}
+		if (entry.sampled) {
+			glTextureParameteri(entry.texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			bindTexture(entry.name, entry.texture);
+		}
+		else
+			bindImage(entry.name, 0, entry.texture, imageAccess(entry.access), entry.format.internalFormat);
+	}
+	for (auto& uniform : manifest.uniforms)
+		setUniform(uniform);
+
+	GLuint printBuffer = createPrintBuffer();
+	bindPrintBuffer(program, printBuffer);
+	GLuint counters = createCounterBuffer();
+	resetCounterBuffer(counters);
+	bindCounterBuffer(program, counters);
+
+	TimeStamp begin;
+	for (int i = 0; i < manifest.iterations; ++i) {
+		glUniform1i("iteration", i);
+		glDispatchCompute(manifest.groups[0], manifest.groups[1], manifest.groups[2]);
+		glMemoryBarrier(GL_ALL_BARRIER_BITS);
+	}
+	TimeStamp end;
+
+	// read back everything the shader was allowed to write
+	for (auto& entry : manifest.buffers) {
+		if (entry.access == Access::in) continue;
+		std::vector<char> data(entry.size);
+		glGetNamedBufferSubData(entry.buffer, 0, entry.size, data.data());
+		if (!writeFile(entry.file, data)) std::cout << "couldn't write " << entry.file << "\n";
+	}
+	for (auto& entry : manifest.images) {
+		if (entry.access == Access::in) continue;
+		std::vector<char> data(size_t(entry.width) * entry.height * entry.format.texelSize);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glGetTextureImage(entry.texture, 0, entry.format.format, entry.format.type, GLsizei(data.size()), data.data());
+		if (!writeFile(entry.file, data)) std::cout << "couldn't write " << entry.file << "\n";
+	}
+
+	size_t printed = 0;
+	const auto decodeBegin = std::chrono::steady_clock::now();
+	decodePrintBuffer(printBuffer, [&](const char* text, size_t length) {
+		if (!quiet) std::cout.write(text, length);
+		printed += length;
+	});
+	const double decodeTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - decodeBegin).count();
+	std::cout << getCounterBufferString(counters);
+	if (printed > 0)
+		std::cout << "printf: " << printed << " characters decoded in " << decodeTime << " ms\n";
+	const double total = gpuTime(begin, end);
+	std::cout << manifest.iterations << " x (" << manifest.groups[0] << ", " << manifest.groups[1] << ", " << manifest.groups[2] << "): "
+		<< total << " ms, " << (manifest.iterations > 0 ? total / manifest.iterations : 0.0) << " ms per dispatch\n";
+
+	deletePrintBuffer(printBuffer);
+	glDeleteBuffers(1, &counters);
+	return 0;
+}
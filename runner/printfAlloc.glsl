@@ -0,0 +1,14 @@
+#version 450
+
+// printf allocation benchmark: half a million invocations, two out of three printing. compare the dispatch time of
+//   runner printfAlloc.glsl printfAlloc.txt -q
+// with the same plus -a, which flips between one atomic per record and one per subgroup
+
+layout(local_size_x = 64) in;
+
+void main() {
+	enablePrintf();
+	const uint i = gl_GlobalInvocationID.x;
+	if (i % 3u != 1u)
+		printf("%d %f\n", int(i), float(i) * .5);
+}
@@ -0,0 +1,13 @@
+#version 450
+
+// printf decoding benchmark: fills the whole print buffer (16M values, the createPrintBuffer default) with records to decode.
+//   runner printfDecode.glsl printfDecode.txt -q
+// prints how long decoding took; the prints that didn't fit are only counted
+
+layout(local_size_x = 64) in;
+
+void main() {
+	enablePrintf();
+	const uint i = gl_GlobalInvocationID.x;
+	printf("hello %d: %f %^3.2f\n", int(i), float(i) * .25, vec3(i, i + 1u, i + 2u) / 3.);
+}
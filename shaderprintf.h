@@ -25,6 +25,47 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <algorithm>
+
+// the print buffer starts with a small header: the write position, the read position (ring buffers only),
+// the number of prints dropped for lack of space, the mask applied to write positions (all ones for one-shot buffers)
+// and the failure counters of shader checks (assert and checkFinite), one per site modulo checkSlots
+namespace printf_detail {
+	constexpr unsigned checkSlots = 252;
+	constexpr unsigned headerSize = 4 + checkSlots;
+
+	// binds a buffer to the program's storage block of the given name (if it has one); like bindBuffer, the block's binding
+	// is its resource index, so it can't collide with blocks bound by name (they'd all default to binding 0 otherwise)
+	inline void bindStorageBlock(GLuint program, const char* name, GLuint buffer) {
+		const GLuint index = glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, name);
+		if (index == GL_INVALID_INDEX)
+			return;
+		glShaderStorageBlockBinding(program, index, index);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, buffer);
+	}
+
+	// writes a note about prints that were dropped by the shader for lack of space
+	template<typename Sink>
+	inline void droppedNote(unsigned count, Sink&& sink) {
+		if (count == 0)
+			return;
+		char note[64];
+		const int length = std::snprintf(note, sizeof(note), "[printf: %u prints dropped, buffer full]\n", count);
+		sink((const char*)note, size_t(length));
+	}
+}
+
+// how many failures of each shader check are recorded; later ones are only counted
+inline unsigned& printfCheckLimit() {
+	static unsigned limit = 8;
+	return limit;
+}
 
 // creates a shader storage buffer object to be used with the print functionality.
 // any SSBO can be used, this is just for convenience and does nothing special.
@@ -42,97 +83,799 @@ inline void deletePrintBuffer(GLuint printBuffer) {
 
 // binds a print buffer to the current program; call anywhere between glUseProgram and the draw/dispatch call
 inline void bindPrintBuffer(GLuint program, GLuint printBuffer) {
-	// reset the buffer; only first value relevant (writing position / size of output), rest is filled up to the index this states
-	unsigned beginIterator = 0u;
-	glNamedBufferSubData(printBuffer, 0, sizeof(unsigned), &beginIterator);
+	// reset the header; the rest is filled up to the index the write position states
+	unsigned header[printf_detail::headerSize] = {};
+	header[3] = 0xFFFFFFFFu;
+	glNamedBufferSubData(printBuffer, 0, sizeof(header), header);
+
+	printf_detail::bindStorageBlock(program, "printfBuffer", printBuffer);
+}
+
+namespace printf_detail {
+
+	// the conversions supported by the printf parser (%c and %s are not available in shaders)
+	inline bool isConversion(unsigned ch) {
+		return ch != 0 && ch < 128 && std::strchr("eEfFgGdiuoxXaA", int(ch)) != nullptr;
+	}
+
+	// a single parsed format specifier; simple ones ("%d", "%.3f", "%x", ...) skip snprintf and are formatted with to_chars
+	struct Specifier {
+		char format[32];
+		char conversion = 0;
+		int precision = -1;
+		bool simple = true;
+	};
+
+	// a piece of a format string: literal text, or a value (vecSize > 0) to be formatted with spec
+	struct Segment {
+		std::string text;
+		Specifier spec;
+		int vecSize = 0;
+	};
+
+	// a format string as interned by the preprocessor; the GPU only writes its index and the argument values
+	struct Format {
+		std::string text;
+		std::vector<Segment> segments;
+		unsigned valueCount = 0;
+		unsigned uses = 0; // sites using the format; an unused entry is free to be taken by a new one
+	};
+
+	// splits a format string into literal text and specifiers
+	inline Format parseFormat(const std::string& text) {
+		Format result;
+		result.text = text;
+		Segment literal;
+		for (size_t i = 0; i < text.length(); ++i) {
+			if (text[i] != '%') {
+				literal.text += text[i];
+				continue;
+			}
+			// if followed by another %, we're actually supposed to print '%'
+			if (i + 1 < text.length() && text[i + 1] == '%') {
+				literal.text += '%';
+				i++;
+				continue;
+			}
+
+			// otherwise we'll be printing numbers; parse the specifier and the possible vector size
+			Segment value;
+			value.vecSize = 1;
+			size_t formatLength = 0;
+			while (i < text.length() && !isConversion((unsigned char)text[i])) {
+				const char ch = text[i];
+				// a special feature to support vector prints
+				if (ch == '^' && i + 1 < text.length()) {
+					value.vecSize = text[i + 1] - '0';
+					i += 2;
+					continue;
+				}
+				if (ch == '.')
+					value.spec.precision = 0;
+				else if (ch >= '0' && ch <= '9' && value.spec.precision >= 0)
+					value.spec.precision = value.spec.precision * 10 + (ch - '0');
+				else if (ch != '%')
+					value.spec.simple = false; // flags, widths and length modifiers
+				if (formatLength < sizeof(value.spec.format) - 2)
+					value.spec.format[formatLength++] = ch;
+				i++;
+			}
+			// a broken specifier is printed as is
+			if (i >= text.length() || value.vecSize < 1 || value.vecSize > 4) {
+				literal.text += text.substr(text.rfind('%', i));
+				break;
+			}
+			value.spec.conversion = text[i];
+			value.spec.format[formatLength++] = text[i];
+			value.spec.format[formatLength] = '\0';
 
-	GLint binding;
-	GLenum prop = GL_BUFFER_BINDING;
-	// get the binding that our printf buffer happened to be given
-	glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, "printfBuffer"), 1, &prop, sizeof(binding), nullptr, &binding);
+			if (literal.text.length() > 0)
+				result.segments.push_back(std::move(literal));
+			literal = Segment();
+			result.valueCount += unsigned(value.vecSize);
+			result.segments.push_back(std::move(value));
+		}
+		if (literal.text.length() > 0)
+			result.segments.push_back(std::move(literal));
+		return result;
+	}
+
+	// the host-side table of every format string seen by the preprocessor; shared by all programs so that one buffer can be printed to by many
+	inline std::vector<Format>& formats() {
+		static std::vector<Format> table;
+		return table;
+	}
+
+	inline std::unordered_map<std::string, unsigned>& formatIndices() {
+		static std::unordered_map<std::string, unsigned> indices;
+		return indices;
+	}
+
+	// returns the index of the given format string for a new site, adding it to the table if it's new
+	inline unsigned internFormat(const std::string& text) {
+		std::vector<Format>& table = formats();
+		auto found = formatIndices().find(text);
+		if (found != formatIndices().end()) {
+			table[found->second].uses++;
+			return found->second;
+		}
+		unsigned index = 0;
+		while (index < table.size() && table[index].uses > 0)
+			++index;
+		if (index == table.size())
+			table.emplace_back();
+		table[index] = parseFormat(text);
+		table[index].uses = 1;
+		formatIndices().emplace(text, index);
+		return index;
+	}
+
+	// a site no longer uses the format
+	inline void releaseFormat(unsigned index) {
+		std::vector<Format>& table = formats();
+		if (--table[index].uses > 0)
+			return;
+		formatIndices().erase(table[index].text);
+		table[index] = Format();
+		while (table.size() > 0 && table.back().uses == 0)
+			table.pop_back();
+	}
+
+	enum class SiteKind { print, assertion, finite, released };
+
+	// a printf call (or a shader check) in a shader; every printed record starts with the index of its site followed by the invocation that printed it
+	struct Site {
+		SiteKind kind = SiteKind::print;
+		unsigned format = 0; // index to formats()
+		std::string file; // the name the source was given to the preprocessor with, if any
+		unsigned line = 0; // line of the call in the original source (as mapped by #line)
+		GLenum stage = 0;
+		GLuint shader = 0, program = 0; // the program is known once tagPrintfProgram has been called for it
+		unsigned slot = 0; // the failure counter of a shader check
+	};
+
+	constexpr unsigned recordHeaderSize = 4;
+
+	// site indices are compiled into the shaders, so sites stay where they are until released and released entries are taken by new ones
+	inline std::vector<Site>& sites() {
+		static std::vector<Site> table;
+		return table;
+	}
+
+	inline Site releasedSite() {
+		Site site;
+		site.kind = SiteKind::released;
+		return site;
+	}
+
+	// the index of count consecutive free sites for a new shader; shader checks take up to four
+	inline unsigned allocateSites(unsigned count) {
+		std::vector<Site>& table = sites();
+		unsigned run = 0, i = 0;
+		for (; i < table.size() && run < count; ++i)
+			run = table[i].kind == SiteKind::released ? run + 1 : 0;
+		if (run < count) {
+			table.resize(table.size() + count - run, releasedSite());
+			i = unsigned(table.size());
+		}
+		return i - count;
+	}
+
+	// frees the sites matching the predicate along with the formats only they used
+	template<typename Predicate>
+	inline void releaseSites(Predicate&& predicate) {
+		std::vector<Site>& table = sites();
+		for (Site& site : table)
+			if (site.kind != SiteKind::released && predicate(site)) {
+				releaseFormat(site.format);
+				site = releasedSite();
+			}
+		while (table.size() > 0 && table.back().kind == SiteKind::released)
+			table.pop_back();
+	}
+
+	// what identifies an invocation in each stage
+	inline const char* invocationId(GLenum stage) {
+		switch (stage) {
+		case GL_COMPUTE_SHADER: return "gl_GlobalInvocationID";
+		case GL_VERTEX_SHADER: return "uvec3(gl_VertexID,gl_InstanceID,0)";
+		case GL_TESS_CONTROL_SHADER: return "uvec3(gl_PrimitiveID,gl_InvocationID,0)";
+		case GL_TESS_EVALUATION_SHADER: return "uvec3(gl_PrimitiveID,0,0)";
+		case GL_GEOMETRY_SHADER: return "uvec3(gl_PrimitiveIDIn,gl_InvocationID,0)";
+		case GL_FRAGMENT_SHADER: return "uvec3(uvec2(gl_FragCoord.xy),gl_PrimitiveID)";
+		default: return "uvec3(0)";
+		}
+	}
 
-	// bind to whatever slot we happened to get
-	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, printBuffer);
+	// the line number of a position in the source, taking #line directives into account
+	inline unsigned lineOf(const std::string& source, size_t position) {
+		unsigned line = 1;
+		size_t from = 0;
+		const size_t directive = source.rfind("#line", position);
+		if (directive != std::string::npos) {
+			line = unsigned(std::strtoul(source.c_str() + directive + 5, nullptr, 10));
+			from = source.find('\n', directive);
+			if (from == std::string::npos || from > position)
+				return line;
+			from++;
+		}
+		for (size_t i = from; i < position; ++i)
+			if (source[i] == '\n')
+				++line;
+		return line;
+	}
+
+	// a COUNT or HISTOGRAM in some shader; all counters live in one buffer, this one at [offset, offset+bins)
+	struct Counter {
+		std::string name;
+		unsigned offset = 0, bins = 1;
+	};
+
+	inline std::vector<Counter>& counters() {
+		static std::vector<Counter> table;
+		return table;
+	}
+
+	// returns the index of the named counter, adding it if it's new; a name keeps the bin count it was first seen with
+	inline unsigned internCounter(const std::string& name, unsigned bins) {
+		std::vector<Counter>& table = counters();
+		for (unsigned i = 0; i < table.size(); ++i)
+			if (table[i].name == name)
+				return i;
+		Counter counter;
+		counter.name = name;
+		counter.offset = table.empty() ? 0 : table.back().offset + table.back().bins;
+		counter.bins = bins > 0 ? bins : 1;
+		table.push_back(counter);
+		return unsigned(table.size() - 1);
+	}
+
+	// splits a list of arguments at the commas that aren't inside parentheses or strings
+	inline std::vector<std::string> splitArguments(const std::string& arguments) {
+		std::vector<std::string> result(1);
+		int depth = 0;
+		bool inString = false;
+		for (size_t i = 0; i < arguments.length(); ++i) {
+			const char c = arguments[i];
+			if (c == '"' && (i == 0 || arguments[i - 1] != '\\')) inString = !inString;
+			if (!inString && (c == '(' || c == '[')) depth++;
+			if (!inString && (c == ')' || c == ']')) depth--;
+			if (!inString && depth == 0 && c == ',')
+				result.emplace_back();
+			else
+				result.back() += c;
+		}
+		return result;
+	}
+
+	// the text inside the quotes of a string literal argument
+	inline std::string unquote(const std::string& argument) {
+		const size_t begin = argument.find('"'), end = argument.rfind('"');
+		return (begin == std::string::npos || end == begin) ? argument : argument.substr(begin + 1, end - begin - 1);
+	}
+
+	// the position of the parenthesis that closes the one at open
+	inline size_t closingParenthesis(const std::string& source, size_t open) {
+		int depth = 0;
+		for (size_t i = open; i < source.length(); ++i) {
+			if (source[i] == '(') depth++;
+			if (source[i] == ')' && --depth == 0) return i;
+		}
+		return std::string::npos;
+	}
+
+	// formats a single value into [begin, end); returns the length the full output would have
+	inline size_t formatValue(const Specifier& spec, unsigned bits, char* begin, char* end) {
+		const bool isFloatType = !std::strchr("diuoxX", spec.conversion);
+		if (spec.simple && spec.conversion != 'a' && spec.conversion != 'A') {
+			char number[64];
+			std::to_chars_result result;
+			float asFloat;
+			std::memcpy(&asFloat, &bits, sizeof(float));
+			switch (spec.conversion) {
+			case 'd': case 'i': result = std::to_chars(number, number + sizeof(number), int(bits)); break;
+			case 'u': result = std::to_chars(number, number + sizeof(number), bits); break;
+			case 'o': result = std::to_chars(number, number + sizeof(number), bits, 8); break;
+			case 'x': case 'X': result = std::to_chars(number, number + sizeof(number), bits, 16); break;
+			case 'e': case 'E': result = std::to_chars(number, number + sizeof(number), double(asFloat), std::chars_format::scientific, spec.precision < 0 ? 6 : spec.precision); break;
+			case 'g': case 'G': result = std::to_chars(number, number + sizeof(number), double(asFloat), std::chars_format::general, spec.precision < 0 ? 6 : (spec.precision == 0 ? 1 : spec.precision)); break;
+			default: result = std::to_chars(number, number + sizeof(number), double(asFloat), std::chars_format::fixed, spec.precision < 0 ? 6 : spec.precision); break;
+			}
+			if (result.ec == std::errc()) {
+				const size_t length = size_t(result.ptr - number);
+				if (spec.conversion == 'X' || spec.conversion == 'E' || spec.conversion == 'G' || spec.conversion == 'F')
+					for (char* c = number; c != result.ptr; ++c)
+						*c = char(std::toupper(*c));
+				if (length <= size_t(end - begin))
+					std::memcpy(begin, number, length);
+				return length;
+			}
+		}
+		// anything with flags or widths goes through the C library
+		float asFloat;
+		std::memcpy(&asFloat, &bits, sizeof(float));
+		const int length = isFloatType ?
+			std::snprintf(begin, size_t(end - begin), spec.format, asFloat) :
+			std::snprintf(begin, size_t(end - begin), spec.format, bits);
+		return length < 0 ? 0 : size_t(length);
+	}
 }
 
-// fetches the printed buffer from VRAM and turns it into an std::string
-inline std::string getPrintBufferString(GLuint printBuffer) {
+namespace printf_detail {
+
+	// gathers output into a fixed chunk that's handed to the sink whenever it fills up
+	template<typename Sink>
+	struct ChunkWriter {
+		Sink& sink;
+		char chunk[4096];
+		size_t used = 0;
+
+		ChunkWriter(Sink& sink) : sink(sink) {}
+		~ChunkWriter() { flush(); }
+
+		void flush() {
+			if (used > 0) sink((const char*)chunk, used);
+			used = 0;
+		}
+		void put(const char* text, size_t length) {
+			while (length > 0) {
+				if (used == sizeof(chunk)) flush();
+				const size_t count = (length < sizeof(chunk) - used) ? length : sizeof(chunk) - used;
+				std::memcpy(chunk + used, text, count);
+				used += count;
+				text += count;
+				length -= count;
+			}
+		}
+		// prints straight into the chunk
+		void value(const Specifier& spec, unsigned bits) {
+			size_t length = formatValue(spec, bits, chunk + used, chunk + sizeof(chunk));
+			// didn't fit; flush and try again with the whole chunk available (if it still doesn't fit, the output is truncated)
+			if (length >= sizeof(chunk) - used && used > 0) {
+				flush();
+				length = formatValue(spec, bits, chunk, chunk + sizeof(chunk));
+			}
+			used += (length < sizeof(chunk) - used) ? length : sizeof(chunk) - used - 1;
+		}
+	};
+
+	// formats the values of one record (for vectors adds parentheses and commas as in "(a, b, c)")
+	template<typename Sink>
+	inline void formatRecord(const Format& format, const unsigned* values, ChunkWriter<Sink>& writer) {
+		for (const Segment& segment : format.segments) {
+			if (segment.vecSize == 0) {
+				writer.put(segment.text.data(), segment.text.length());
+				continue;
+			}
+			if (segment.vecSize > 1) writer.put("(", 1);
+			for (int j = 0; j < segment.vecSize; ++j) {
+				writer.value(segment.spec, *values++);
+				if (segment.vecSize > 1 && j < segment.vecSize - 1) writer.put(", ", 2);
+			}
+			if (segment.vecSize > 1) writer.put(")", 1);
+		}
+	}
+
+	// calls record(const Site&, const unsigned* header, const Format&, const unsigned* values) for each complete record
+	template<typename Record>
+	inline void forEachRecord(const unsigned* printfData, size_t printedSize, Record&& record) {
+		const std::vector<Site>& siteTable = sites();
+		const std::vector<Format>& formatTable = formats();
+		size_t i = 0;
+		while (i + recordHeaderSize <= printedSize) {
+			// stop at anything that isn't a complete record (the end of a full buffer, for example)
+			const unsigned index = printfData[i];
+			if (index >= siteTable.size() || siteTable[index].kind == SiteKind::released)
+				break;
+			const Format& format = formatTable[siteTable[index].format];
+			if (i + recordHeaderSize + format.valueCount > printedSize)
+				break;
+			record(siteTable[index], printfData + i, format, printfData + i + recordHeaderSize);
+			i += recordHeaderSize + format.valueCount;
+		}
+	}
+}
+
+// streams decoded print data into sink(const char* text, size_t length); the sink is called with consecutive pieces of the output.
+// printfData points to the printed records (the header of the buffer is not included); each record is the index of a printf
+// site and the invocation that printed it, followed by the values to format.
+// no memory is allocated; text is gathered into a fixed chunk on the stack and format strings were parsed when the shader was preprocessed.
+template<typename Sink>
+inline void decodePrintData(const unsigned* printfData, size_t printedSize, Sink&& sink) {
+	printf_detail::ChunkWriter<Sink> writer(sink);
+	printf_detail::forEachRecord(printfData, printedSize, [&](const printf_detail::Site&, const unsigned*, const printf_detail::Format& format, const unsigned* values) {
+		printf_detail::formatRecord(format, values, writer);
+	});
+}
+
+// decodes into a caller-provided buffer; returns the length of the written text. output is truncated to capacity and is not null-terminated.
+inline size_t decodePrintData(const unsigned* printfData, size_t printedSize, char* output, size_t capacity) {
+	size_t written = 0;
+	decodePrintData(printfData, printedSize, [&](const char* text, size_t length) {
+		if (length > capacity - written) length = capacity - written;
+		std::memcpy(output + written, text, length);
+		written += length;
+	});
+	return written;
+}
+
+// fetches the printed buffer from VRAM and calls read(const unsigned* printfData, size_t printedSize, unsigned droppedCount)
+template<typename Read>
+inline void readPrintBuffer(GLuint printBuffer, Read&& read) {
 
 	// get the size of what we want to read and the size of the print buffer
-	unsigned printedSize, bufferSize;
-	glGetNamedBufferSubData(printBuffer, 0, sizeof(unsigned), &printedSize);
-	glGetNamedBufferParameteriv(printBuffer, GL_BUFFER_SIZE, (GLint*)&bufferSize);
-	bufferSize /= sizeof(unsigned);
+	unsigned header[printf_detail::headerSize];
+	GLint bufferSize;
+	glGetNamedBufferSubData(printBuffer, 0, sizeof(header), header);
+	glGetNamedBufferParameteriv(printBuffer, GL_BUFFER_SIZE, &bufferSize);
 
 	// make sure we're not reading past the maximum size
-	if (printedSize > bufferSize)
-		printedSize = bufferSize;
+	const unsigned bufferValues = unsigned(bufferSize) / sizeof(unsigned);
+	unsigned printedSize = header[0];
+	if (printedSize > bufferValues - printf_detail::headerSize)
+		printedSize = bufferValues > printf_detail::headerSize ? bufferValues - printf_detail::headerSize : 0;
 
-	// this vector will hold the CPU copy of the print buffer
-	std::vector<unsigned> printfData(printedSize + 1);
-	printfData[0] = printedSize;
+	// map the buffer if we're allowed to (createPrintBuffer ones are); this avoids copying the whole thing to a temporary
+	GLint immutable, flags;
+	glGetNamedBufferParameteriv(printBuffer, GL_BUFFER_IMMUTABLE_STORAGE, &immutable);
+	glGetNamedBufferParameteriv(printBuffer, GL_BUFFER_STORAGE_FLAGS, &flags);
+	if (printedSize == 0)
+		read((const unsigned*)nullptr, size_t(0), header[2]);
+	else if (!immutable || (flags & GL_MAP_READ_BIT)) {
+		const auto* printfData = (const unsigned*)glMapNamedBufferRange(printBuffer, printf_detail::headerSize * sizeof(unsigned), printedSize * sizeof(unsigned), GL_MAP_READ_BIT);
+		read(printfData, size_t(printedSize), header[2]);
+		glUnmapNamedBuffer(printBuffer);
+	}
+	else {
+		std::vector<unsigned> printfData(printedSize);
+		glGetNamedBufferSubData(printBuffer, printf_detail::headerSize * sizeof(unsigned), GLsizei(printedSize * sizeof(unsigned)), printfData.data());
+		read((const unsigned*)printfData.data(), size_t(printedSize), header[2]);
+	}
+}
 
-	// get the rest of the buffer data (the actual text)
-	glGetNamedBufferSubData(printBuffer, sizeof(unsigned), GLsizei((printfData.size() - 1) * sizeof(unsigned)), printfData.data() + 1);
+// fetches the printed buffer from VRAM and streams the decoded text into sink(const char* text, size_t length)
+template<typename Sink>
+inline void decodePrintBuffer(GLuint printBuffer, Sink&& sink) {
+	readPrintBuffer(printBuffer, [&](const unsigned* printfData, size_t printedSize, unsigned droppedCount) {
+		decodePrintData(printfData, printedSize, sink);
+		// prints that didn't fit were dropped by the shader; say so instead of losing them silently
+		printf_detail::droppedNote(droppedCount, sink);
+	});
+}
 
-	// the final string we're going to build
+// fetches the printed buffer from VRAM into a caller-provided buffer; returns the length of the written text (truncated to capacity, not null-terminated)
+inline size_t decodePrintBuffer(GLuint printBuffer, char* output, size_t capacity) {
+	size_t written = 0;
+	decodePrintBuffer(printBuffer, [&](const char* text, size_t length) {
+		if (length > capacity - written) length = capacity - written;
+		std::memcpy(output + written, text, length);
+		written += length;
+	});
+	return written;
+}
+
+// fetches the printed buffer from VRAM and turns it into an std::string
+inline std::string getPrintBufferString(GLuint printBuffer) {
 	std::string result;
+	decodePrintBuffer(printBuffer, [&](const char* text, size_t length) { result.append(text, length); });
+	return result;
+}
 
-	// to hold the temporary results of formatting
-	char intermediate[1024];
+// a single printed record; the values are stored in PrintRecords::values as raw bits
+struct PrintRecord {
+	unsigned site; // index to printfSites()
+	unsigned invocation[3]; // gl_GlobalInvocationID in compute shaders; see printf_detail::invocationId for the other stages
+	unsigned valueOffset, valueCount;
+};
 
-	// this loop parses the formatting of the result
-	for (size_t i = 1; i < printfData[0]; ++i) {
-		// % indicates the beginning of a formatted input
-		if (printfData[i] == '%')
-			// if followed by another %, we're actually supposed to print '%'
-			if (printfData[i + 1] == '%') {
-				result += "%";
-				i++;
+// the printf sites (file, line, program, format) that records refer to
+inline const std::vector<printf_detail::Site>& printfSites() {
+	return printf_detail::sites();
+}
+
+// decoded print output as typed records; filter, sort or group the record vector freely, the values stay where they are
+struct PrintRecords {
+	std::vector<PrintRecord> records;
+	std::vector<unsigned> values;
+	unsigned dropped = 0;
+
+	const printf_detail::Site& site(const PrintRecord& record) const { return printf_detail::sites()[record.site]; }
+	const printf_detail::Format& format(const PrintRecord& record) const { return printf_detail::formats()[site(record).format]; }
+
+	// the i:th value of a record; T should match the conversion used (float for e/f/g, int for d/i, unsigned otherwise)
+	template<typename T>
+	T value(const PrintRecord& record, unsigned i) const {
+		T result;
+		std::memcpy(&result, &values[record.valueOffset + i], sizeof(T));
+		return result;
+	}
+
+	// the record formatted as printf would have
+	std::string text(const PrintRecord& record) const {
+		std::string result;
+		auto sink = [&](const char* text, size_t length) { result.append(text, length); };
+		{
+			printf_detail::ChunkWriter<decltype(sink)> writer(sink);
+			printf_detail::formatRecord(format(record), values.data() + record.valueOffset, writer);
+		}
+		return result;
+	}
+
+	// indices of the records of each site
+	std::vector<std::vector<size_t>> groupBySite() const {
+		std::vector<std::vector<size_t>> groups(printf_detail::sites().size());
+		for (size_t i = 0; i < records.size(); ++i)
+			groups[records[i].site].push_back(i);
+		return groups;
+	}
+
+	// one row per record: site, file, line, program, invocation, the formatted text and the values as separate columns
+	bool writeCSV(const std::string& path) const {
+		std::ofstream file(path);
+		if (!file)
+			return false;
+		unsigned maxValues = 0;
+		for (const PrintRecord& record : records)
+			maxValues = record.valueCount > maxValues ? record.valueCount : maxValues;
+		file << "site,file,line,program,x,y,z,text";
+		for (unsigned i = 0; i < maxValues; ++i)
+			file << ",v" << i;
+		file << "\n";
+
+		std::string text;
+		for (const PrintRecord& record : records) {
+			const printf_detail::Site& recordSite = site(record);
+			file << record.site << ",\"" << recordSite.file << "\"," << recordSite.line << "," << recordSite.program << "," << record.invocation[0] << "," << record.invocation[1] << "," << record.invocation[2] << ",\"";
+			// quotes are doubled in CSV; the usual trailing newline is left out
+			text = this->text(record);
+			if (text.length() > 0 && text.back() == '\n')
+				text.pop_back();
+			for (char c : text) {
+				if (c == '"') file << '"';
+				file << c;
 			}
-		// otherwise we'll be printing numbers
-			else {
-				// first parse out the possible vector size
-				int vecSize = 1;
-				std::string format;
-				while (std::string(1, printfData[i]).find_first_of("eEfFgGdiuoxXaA") == std::string::npos) {
-					if (printfData[i] == '^') {
-						vecSize = printfData[i + 1] - '0';
-						i += 2;
-					}
-					else {
-						format = format + std::string(1, printfData[i]);
-						i++;
-					}
-				}
-				format += printfData[i];
-
-				// determine whether we'll have to do type conversion
-				bool isFloatType = std::string(1, printfData[i]).find_first_of("diuoxX") == std::string::npos;
-
-				// print to a temporary buffer, add result to string (for vectors add parentheses and commas as in "(a, b, c)") 
-				if (vecSize > 1) result += "(";
-
-				for (int j = 0; j < vecSize; ++j) {
-					i++;
-					if (isFloatType)
-						snprintf(intermediate, 1024, format.c_str(), *((float*)&printfData[i]));
-					else
-						snprintf(intermediate, 1024, format.c_str(), printfData[i]);
-					result += std::string(intermediate);
-					if (vecSize > 1 && j < vecSize - 1) result += ", ";
+			file << "\"";
+			unsigned i = 0;
+			for (const printf_detail::Segment& segment : format(record).segments)
+				for (int j = 0; j < segment.vecSize; ++j, ++i) {
+					file << ",";
+					if (!std::strchr("diuoxX", segment.spec.conversion)) file << value<float>(record, i);
+					else if (segment.spec.conversion == 'd' || segment.spec.conversion == 'i') file << value<int>(record, i);
+					else file << value<unsigned>(record, i);
 				}
+			for (; i < maxValues; ++i)
+				file << ",";
+			file << "\n";
+		}
+		return bool(file);
+	}
 
-				if (vecSize > 1) result += ")";
+	// columnar export: raw little-endian uint32 columns prefix.site.u32, .x.u32, .y.u32, .z.u32, .offset.u32 (valueOffset per record)
+	// and .values.u32, plus prefix.sites.csv describing the sites. loads directly into numpy/pandas/arrow without parsing
+	bool writeColumns(const std::string& prefix) const {
+		auto column = [&](const char* name, auto&& get) {
+			std::vector<unsigned> data(records.size());
+			for (size_t i = 0; i < records.size(); ++i)
+				data[i] = get(records[i]);
+			std::ofstream file(prefix + name, std::ios::binary);
+			file.write((const char*)data.data(), std::streamsize(data.size() * sizeof(unsigned)));
+			return bool(file);
+		};
+		bool ok = column(".site.u32", [](const PrintRecord& r) { return r.site; });
+		ok = ok && column(".x.u32", [](const PrintRecord& r) { return r.invocation[0]; });
+		ok = ok && column(".y.u32", [](const PrintRecord& r) { return r.invocation[1]; });
+		ok = ok && column(".z.u32", [](const PrintRecord& r) { return r.invocation[2]; });
+		ok = ok && column(".offset.u32", [](const PrintRecord& r) { return r.valueOffset; });
+		std::ofstream valueFile(prefix + ".values.u32", std::ios::binary);
+		valueFile.write((const char*)values.data(), std::streamsize(values.size() * sizeof(unsigned)));
+		ok = ok && bool(valueFile);
+
+		std::ofstream siteFile(prefix + ".sites.csv");
+		siteFile << "site,file,line,program,stage,format\n";
+		const std::vector<printf_detail::Site>& siteTable = printf_detail::sites();
+		for (size_t i = 0; i < siteTable.size(); ++i) {
+			siteFile << i << ",\"" << siteTable[i].file << "\"," << siteTable[i].line << "," << siteTable[i].program << "," << siteTable[i].stage << ",\"";
+			for (char c : printf_detail::formats()[siteTable[i].format].text) {
+				if (c == '"') siteFile << '"';
+				if (c == '\n') siteFile << "\\n";
+				else siteFile << c;
 			}
-		else // otherwise it's a single character, just add it to the result
-			result += std::string(1, printfData[i]);
+			siteFile << "\"\n";
+		}
+		return ok && bool(siteFile);
+	}
+};
+
+// decodes print data into records (appending to the given ones)
+inline void decodePrintRecords(const unsigned* printfData, size_t printedSize, PrintRecords& result) {
+	printf_detail::forEachRecord(printfData, printedSize, [&](const printf_detail::Site&, const unsigned* header, const printf_detail::Format& format, const unsigned* values) {
+		result.records.push_back({ header[0], { header[1], header[2], header[3] }, unsigned(result.values.size()), format.valueCount });
+		result.values.insert(result.values.end(), values, values + format.valueCount);
+	});
+}
+
+// fetches the printed buffer from VRAM and decodes it into records
+inline PrintRecords getPrintBufferRecords(GLuint printBuffer) {
+	PrintRecords result;
+	readPrintBuffer(printBuffer, [&](const unsigned* printfData, size_t printedSize, unsigned droppedCount) {
+		decodePrintRecords(printfData, printedSize, result);
+		result.dropped = droppedCount;
+	});
+	return result;
+}
+
+// the failed shader checks (assert, checkFinite) in a print buffer with their file and line; empty if everything passed.
+// only the first printfCheckLimit() failures of each check are recorded, the rest are just counted
+inline std::string getShaderCheckFailures(GLuint printBuffer) {
+	const PrintRecords printed = getPrintBufferRecords(printBuffer);
+	std::string result;
+	for (const PrintRecord& record : printed.records)
+		if (printed.site(record).kind != printf_detail::SiteKind::print)
+			result += printed.text(record);
+
+	unsigned failures[printf_detail::checkSlots];
+	glGetNamedBufferSubData(printBuffer, 4 * sizeof(unsigned), sizeof(failures), failures);
+	const std::vector<printf_detail::Site>& siteTable = printf_detail::sites();
+	for (unsigned slot = 0; slot < printf_detail::checkSlots; ++slot) {
+		if (failures[slot] <= printfCheckLimit())
+			continue;
+		// checks whose site indices are checkSlots apart share a counter
+		result += std::to_string(failures[slot] - printfCheckLimit()) + " more failures at";
+		for (size_t i = 0; i < siteTable.size(); ++i)
+			if ((siteTable[i].kind == printf_detail::SiteKind::assertion || siteTable[i].kind == printf_detail::SiteKind::finite) && siteTable[i].slot == slot && (i == 0 || siteTable[i - 1].slot != slot))
+				result += " " + (siteTable[i].file.length() > 0 ? siteTable[i].file + ":" : std::string("line ")) + std::to_string(siteTable[i].line);
+		result += "\n";
 	}
-	// ... and we're done.
 	return result;
 }
 
-#include <cctype>
+// creates the buffer that COUNT and HISTOGRAM accumulate into; size is in values and has to cover every counter of the bound programs
+inline GLuint createCounterBuffer(unsigned size = 64 * 1024) {
+	GLuint counterBuffer;
+	glCreateBuffers(1, &counterBuffer);
+	glNamedBufferData(counterBuffer, size * sizeof(unsigned), nullptr, GL_DYNAMIC_READ);
+	glClearNamedBufferData(counterBuffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+	return counterBuffer;
+}
+
+// zeroes all counters
+inline void resetCounterBuffer(GLuint counterBuffer) {
+	glClearNamedBufferData(counterBuffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+}
+
+// binds a counter buffer to the current program; counters keep accumulating over dispatches until reset
+inline void bindCounterBuffer(GLuint program, GLuint counterBuffer) {
+	printf_detail::bindStorageBlock(program, "shaderCounters", counterBuffer);
+}
+
+// the bins of the named counter (a single value for COUNT); empty if no shader has used the name
+inline std::vector<unsigned> getCounter(GLuint counterBuffer, const std::string& name) {
+	for (const printf_detail::Counter& counter : printf_detail::counters())
+		if (counter.name == name) {
+			std::vector<unsigned> result(counter.bins);
+			glGetNamedBufferSubData(counterBuffer, counter.offset * sizeof(unsigned), counter.bins * sizeof(unsigned), result.data());
+			return result;
+		}
+	return {};
+}
+
+// all counters as text, one per line: "name: count" or "name: bin0 bin1 ..."
+inline std::string getCounterBufferString(GLuint counterBuffer) {
+	const std::vector<printf_detail::Counter>& table = printf_detail::counters();
+	if (table.empty())
+		return "";
+	GLint bufferSize;
+	glGetNamedBufferParameteriv(counterBuffer, GL_BUFFER_SIZE, &bufferSize);
+	std::vector<unsigned> values(table.back().offset + table.back().bins);
+	const size_t available = values.size() < size_t(bufferSize) / sizeof(unsigned) ? values.size() : size_t(bufferSize) / sizeof(unsigned);
+	glGetNamedBufferSubData(counterBuffer, 0, GLsizeiptr(available * sizeof(unsigned)), values.data());
+
+	std::string result;
+	for (const printf_detail::Counter& counter : table) {
+		result += counter.name + ":";
+		for (unsigned i = 0; i < counter.bins; ++i)
+			result += " " + (counter.offset + i < available ? std::to_string(values[counter.offset + i]) : std::string("?"));
+		result += "\n";
+	}
+	return result;
+}
+
+// a print buffer for continuous output: shaders keep appending with wraparound and the CPU decodes the frames the GPU has finished,
+// found out through fences, without stalling. prints that would overwrite undecoded output are dropped and counted.
+// usage: ring.bind(program) before the draws/dispatches of a program, ring.endFrame() once per frame and ring.drain(sink) whenever
+// convenient, where sink(const char* text, size_t length) gets the frames in order, e.g. [](const char* t, size_t n) { fwrite(t, 1, n, stdout); }
+struct PrintRing {
+	static constexpr unsigned maxFrames = 8;
+
+	GLuint buffer = 0, frameBuffer = 0;
+	unsigned* header = nullptr; // persistently mapped; the printed data follows the header
+	const unsigned* frameEnds = nullptr; // write position and drop count at the end of each pending frame
+	unsigned capacity = 0; // a power of two
+	GLsync fences[maxFrames] = {};
+	unsigned firstFrame = 0, frameCount = 0;
+	unsigned read = 0, overflow = 0;
+	std::vector<unsigned> unwrapped; // for frames that wrap around the end of the buffer
+
+	// size is the capacity in values, rounded up to a power of two
+	PrintRing(unsigned size = 4 * 1024 * 1024) {
+		for (capacity = 1; capacity < size; capacity *= 2);
+		const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, (printf_detail::headerSize + capacity) * sizeof(unsigned), nullptr, flags);
+		header = (unsigned*)glMapNamedBufferRange(buffer, 0, (printf_detail::headerSize + capacity) * sizeof(unsigned), flags);
+		std::memset(header, 0, printf_detail::headerSize * sizeof(unsigned));
+		header[3] = capacity - 1;
+
+		glCreateBuffers(1, &frameBuffer);
+		glNamedBufferStorage(frameBuffer, maxFrames * 2 * sizeof(unsigned), nullptr, GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+		frameEnds = (const unsigned*)glMapNamedBufferRange(frameBuffer, 0, maxFrames * 2 * sizeof(unsigned), GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+	}
+	PrintRing(const PrintRing&) = delete;
+	PrintRing& operator=(const PrintRing&) = delete;
+	~PrintRing() {
+		for (unsigned i = 0; i < frameCount; ++i)
+			glDeleteSync(fences[(firstFrame + i) % maxFrames]);
+		glUnmapNamedBuffer(buffer);
+		glUnmapNamedBuffer(frameBuffer);
+		glDeleteBuffers(1, &buffer);
+		glDeleteBuffers(1, &frameBuffer);
+	}
+
+	// binds the ring to the current program; unlike bindPrintBuffer this doesn't reset anything
+	void bind(GLuint program) const {
+		printf_detail::bindStorageBlock(program, "printfBuffer", buffer);
+	}
+
+	// marks the end of a frame: everything printed before this is decoded together once the GPU gets here.
+	// if too many frames are pending, this one is merged into the previous one
+	void endFrame() {
+		unsigned frame = (firstFrame + frameCount) % maxFrames;
+		if (frameCount == maxFrames) {
+			frame = (firstFrame + frameCount - 1) % maxFrames;
+			glDeleteSync(fences[frame]);
+		}
+		else
+			frameCount++;
+
+		// the write position and drop count are copied aside, so that later frames can keep printing
+		glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT | GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+		glCopyNamedBufferSubData(buffer, frameBuffer, 0, frame * 2 * sizeof(unsigned), sizeof(unsigned));
+		glCopyNamedBufferSubData(buffer, frameBuffer, 2 * sizeof(unsigned), (frame * 2 + 1) * sizeof(unsigned), sizeof(unsigned));
+		fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	// decodes the frames the GPU has finished into sink(const char* text, size_t length), oldest first; with wait, blocks until all pending frames are done
+	template<typename Sink>
+	void drain(Sink&& sink, bool wait = false) {
+		while (frameCount > 0) {
+			const unsigned frame = firstFrame;
+			const GLenum status = glClientWaitSync(fences[frame], GL_SYNC_FLUSH_COMMANDS_BIT, wait ? ~GLuint64(0) : 0);
+			if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+				break;
+			glDeleteSync(fences[frame]);
+			firstFrame = (firstFrame + 1) % maxFrames;
+			frameCount--;
+
+			// the records of a frame are contiguous modulo the capacity
+			const unsigned end = frameEnds[frame * 2], size = end - read, begin = read & (capacity - 1);
+			const unsigned* printfData = header + printf_detail::headerSize;
+			if (begin + size <= capacity)
+				decodePrintData(printfData + begin, size, sink);
+			else {
+				unwrapped.resize(size);
+				std::memcpy(unwrapped.data(), printfData + begin, (capacity - begin) * sizeof(unsigned));
+				std::memcpy(unwrapped.data() + (capacity - begin), printfData, (size - (capacity - begin)) * sizeof(unsigned));
+				decodePrintData(unwrapped.data(), size, sink);
+			}
+			printf_detail::droppedNote(frameEnds[frame * 2 + 1] - overflow, sink);
+			overflow = frameEnds[frame * 2 + 1];
+
+			// hand the space back to the shaders
+			read = end;
+			header[1] = read;
+		}
+	}
+};
 
 inline bool isText(char t) {
 	if (std::isspace(t) || t == ';' || t == '(' || t == ')' || t == '{' || t == '}' || t == '[' || t == ']')
@@ -173,8 +916,79 @@ inline size_t findCall(const std::string& source, const std::string& function) {
 		return tentative;
 }
 
-// a preprocessor for shader source
-inline std::string addPrintToSource(std::string source) {
+// whether the generated code should gather the allocations of a subgroup into a single atomic (when the driver supports subgroup operations).
+// off by default: on llvmpipe runner/printfAlloc.glsl runs slower with it, as there's no contention to save; measure it on the target
+inline bool& printfSubgroupAggregation() {
+	static bool enabled = false;
+	return enabled;
+}
+
+// the buffer definition and the allocation helpers for printed records. printfReserve returns the start of a record or ~0u if it didn't fit;
+// one-shot buffers simply append (a record cut off by the end of the buffer is marked invalid) while ring buffers wrap around
+// but never pass the read position of the CPU. with subgroup support, one invocation per subgroup reserves space for all active
+// invocations and the others offset into its range by a prefix sum; the ballot path only does so when all sizes are the same.
+inline std::string printfDefinitions(bool subgroupAggregation, GLenum stage) {
+	std::string result =
+		"\nlayout(std430)buffer printfBuffer{uint printfLocation;uint printfRead;uint printfOverflow;uint printfMask;uint printfFailures[" + std::to_string(printf_detail::checkSlots) + "];uint printfData[];};"
+		"uint printfReserve(uint size,uint count){"
+		"if(printfMask==0xFFFFFFFFu){"
+		"uint printfBase=atomicAdd(printfLocation,size);"
+		"if(printfBase+size<=uint(printfData.length()))return printfBase;"
+		"if(printfBase<uint(printfData.length()))printfData[printfBase]=0xFFFFFFFFu;"
+		"atomicAdd(printfOverflow,count);return 0xFFFFFFFFu;}"
+		"uint printfCurrent=printfLocation;"
+		"while(printfCurrent+size-printfRead<=printfMask+1u){"
+		"uint printfPrevious=atomicCompSwap(printfLocation,printfCurrent,printfCurrent+size);"
+		"if(printfPrevious==printfCurrent)return printfCurrent;"
+		"printfCurrent=printfPrevious;}"
+		"atomicAdd(printfOverflow,count);return 0xFFFFFFFFu;}";
+	if (!subgroupAggregation)
+		result += "uint printfAlloc(uint size){return printfReserve(size,1u);}";
+	else
+		result =
+		"\n#extension GL_KHR_shader_subgroup_basic : enable"
+		"\n#extension GL_KHR_shader_subgroup_ballot : enable"
+		"\n#extension GL_KHR_shader_subgroup_arithmetic : enable"
+		"\n#extension GL_ARB_shader_ballot : enable"
+		"\n#extension GL_ARB_gpu_shader_int64 : enable" + result +
+		"uint printfAlloc(uint size){"
+		"\n#if defined(GL_KHR_shader_subgroup_arithmetic)&&defined(GL_KHR_shader_subgroup_ballot)\n"
+		"uint printfBase=0u,printfTotal=subgroupAdd(size),printfOffset=subgroupExclusiveAdd(size),printfCount=subgroupBallotBitCount(subgroupBallot(true));"
+		"if(subgroupElect())printfBase=printfReserve(printfTotal,printfCount);"
+		"printfBase=subgroupBroadcastFirst(printfBase);"
+		"return printfBase==0xFFFFFFFFu?printfBase:printfBase+printfOffset;"
+		"\n#else\n#if defined(GL_ARB_shader_ballot)&&defined(GL_ARB_gpu_shader_int64)\n"
+		"uint64_t printfActive=ballotARB(true);"
+		"if(ballotARB(readFirstInvocationARB(size)==size)==printfActive){"
+		"uvec2 printfCount=unpackUint2x32(printfActive),printfBefore=unpackUint2x32(printfActive&gl_SubGroupLtMaskARB);"
+		"uint printfBase=0u;"
+		"if(printfBefore==uvec2(0u))printfBase=printfReserve(size*uint(bitCount(printfCount.x)+bitCount(printfCount.y)),uint(bitCount(printfCount.x)+bitCount(printfCount.y)));"
+		"printfBase=readFirstInvocationARB(printfBase);"
+		"return printfBase==0xFFFFFFFFu?printfBase:printfBase+size*uint(bitCount(printfBefore.x)+bitCount(printfBefore.y));}"
+		"\n#endif\n"
+		"return printfReserve(size,1u);"
+		"\n#endif\n"
+		"}";
+
+	// shader checks: nothing but the test itself runs unless a check fails. failures are counted per slot and recorded
+	// only while the slot has seen fewer than printfCheckLimit() of them; checkFinite has four consecutive sites, one for each vector size
+	return result +
+		"void printfFail(uint slot,uint site,uint count,vec4 values){"
+		"if(atomicAdd(printfFailures[slot],1u)>=" + std::to_string(printfCheckLimit()) + "u)return;"
+		"uint printfIndex=printfAlloc(" + std::to_string(printf_detail::recordHeaderSize) + "u+count);if(printfIndex==0xFFFFFFFFu)return;"
+		"uint printfWrap=printfMask;uvec3 printfInvocation=" + printf_detail::invocationId(stage) + ";"
+		"printfData[printfIndex++&printfWrap]=site;printfData[printfIndex++&printfWrap]=printfInvocation.x;printfData[printfIndex++&printfWrap]=printfInvocation.y;printfData[printfIndex++&printfWrap]=printfInvocation.z;"
+		"for(uint i=0u;i<count;++i)printfData[printfIndex++&printfWrap]=floatBitsToUint(values[i]);}"
+		"void printfAssert(bool condition,uint slot,uint site){if(!condition)printfFail(slot,site,0u,vec4(0));}"
+		"void printfCheckFinite(float x,uint slot,uint site){if(isnan(x)||isinf(x))printfFail(slot,site,1u,vec4(x,0,0,0));}"
+		"void printfCheckFinite(vec2 x,uint slot,uint site){if(any(isnan(x))||any(isinf(x)))printfFail(slot,site+1u,2u,vec4(x,0,0));}"
+		"void printfCheckFinite(vec3 x,uint slot,uint site){if(any(isnan(x))||any(isinf(x)))printfFail(slot,site+2u,3u,vec4(x,0));}"
+		"void printfCheckFinite(vec4 x,uint slot,uint site){if(any(isnan(x))||any(isinf(x)))printfFail(slot,site+3u,4u,x);}";
+}
+
+// a preprocessor for shader source. stage selects what identifies the printing invocation, file and shader are stored
+// with the printf sites for reporting, and subgroupAggregation allows the allocation of print records to use subgroup operations
+inline std::string addPrintToSource(std::string source, GLenum stage = 0, const std::string& file = "", GLuint shader = 0, bool subgroupAggregation = false) {
 
 	// get rid of comments beforehand
 	std::string commentedSource = "";
@@ -191,14 +1005,15 @@ inline std::string addPrintToSource(std::string source) {
 			if (i < commentedSource.length() - 1 && commentedSource[i] == '/' && commentedSource[i + 1] == '/') { commentRow = true; i++; continue; }
 			if (commentedSource[i] == '\n') commentRow = false;
 		}
-		if (!commentLong && !commentRow)
+		// newlines inside comments are kept so that line numbers stay valid
+		if ((!commentLong && !commentRow) || commentedSource[i] == '\n')
 			source += std::string(1, commentedSource[i]);
 	}
 
 	// insert our buffer definition after the glsl version define
 	size_t version = source.find("#version");
 	size_t extension = source.rfind("#extension"); // extensions also need to be defined before actual code
-	if (extension != std::string::npos)	version = max(extension, version);
+	if (extension != std::string::npos)	version = extension > version ? extension : version;
 	size_t lineAfterVersion = 1, bufferInsertOffset = 0;
 
 	if (version != std::string::npos) {
@@ -215,6 +1030,110 @@ inline std::string addPrintToSource(std::string source) {
 				bufferInsertOffset += 1;
 	}
 
+	// shader checks become calls to the helpers with the index of their site (or disappear with SHADERPRINTF_NO_ASSERTS)
+	for (const std::string check : { "assert", "checkFinite" }) {
+		size_t checkLoc = findCall(source, check);
+		while (checkLoc != std::string::npos) {
+			const size_t open = source.find('(', checkLoc), close = printf_detail::closingParenthesis(source, open);
+			if (close == std::string::npos)
+				break;
+			const std::string argument = source.substr(open + 1, close - open - 1);
+#ifdef SHADERPRINTF_NO_ASSERTS
+			// keep the newlines so that line numbers don't change
+			source = source.substr(0, checkLoc) + std::string(std::count(argument.begin(), argument.end(), '\n'), '\n') + source.substr(close + 1);
+#else
+			const unsigned line = printf_detail::lineOf(source, checkLoc);
+			std::string message = (file.length() > 0 ? file + ":" : std::string("line ")) + std::to_string(line) + ": ";
+			for (char c : check == "assert" ? "assertion failed: " + argument : "checkFinite(" + argument + ") failed: ")
+				message += (c == '%') ? "%%" : std::string(1, c);
+
+			printf_detail::Site site;
+			site.kind = check == "assert" ? printf_detail::SiteKind::assertion : printf_detail::SiteKind::finite;
+			site.file = file;
+			site.line = line;
+			site.stage = stage;
+			site.shader = shader;
+			const unsigned firstSite = printf_detail::allocateSites(check == "assert" ? 1 : 4);
+			site.slot = firstSite % printf_detail::checkSlots;
+			if (check == "assert") {
+				site.format = printf_detail::internFormat(message + "\n");
+				printf_detail::sites()[firstSite] = site;
+			}
+			else {
+				unsigned index = firstSite;
+				for (const char* values : { "%g\n", "%^2g\n", "%^3g\n", "%^4g\n" }) {
+					site.format = printf_detail::internFormat(message + values);
+					printf_detail::sites()[index++] = site;
+				}
+			}
+			source = source.substr(0, checkLoc) + (check == "assert" ? "printfAssert(bool(" : "printfCheckFinite((") + argument + ")," +
+				std::to_string(site.slot) + "u," + std::to_string(firstSite) + "u)" + source.substr(close + 1);
+#endif
+			checkLoc = findCall(source, check);
+		}
+	}
+
+	// COUNT("name") and HISTOGRAM("name", value, bins) add to counters; value is converted to int and clamped to the bins, which has to be a literal.
+	// compute shaders gather their counts in shared memory and add them to the buffer once per workgroup
+	const bool sharedCounters = stage == GL_COMPUTE_SHADER;
+	bool countersUsed = false;
+	std::vector<unsigned> sharedOrder; // the counters of this shader in the order of their shared memory
+	auto sharedOffset = [&](unsigned counter) {
+		unsigned offset = 0;
+		for (unsigned used : sharedOrder) {
+			if (used == counter)
+				return offset;
+			offset += printf_detail::counters()[used].bins;
+		}
+		sharedOrder.push_back(counter);
+		return offset;
+	};
+	for (const std::string call : { "COUNT", "HISTOGRAM" }) {
+		size_t callLoc = findCall(source, call);
+		while (callLoc != std::string::npos) {
+			const size_t open = source.find('(', callLoc), close = printf_detail::closingParenthesis(source, open);
+			if (close == std::string::npos)
+				break;
+			const std::vector<std::string> arguments = printf_detail::splitArguments(source.substr(open + 1, close - open - 1));
+			const bool histogram = call == "HISTOGRAM" && arguments.size() > 2;
+			const unsigned counter = printf_detail::internCounter(printf_detail::unquote(arguments[0]), histogram ? unsigned(std::strtoul(arguments[2].c_str(), nullptr, 10)) : 1u);
+			const unsigned bins = printf_detail::counters()[counter].bins;
+
+			std::string index = std::to_string(sharedCounters ? sharedOffset(counter) : printf_detail::counters()[counter].offset) + "u";
+			if (histogram)
+				index += "+uint(clamp(int(" + arguments[1] + "),0," + std::to_string(bins - 1) + "))";
+			source = source.substr(0, callLoc) + (sharedCounters ? "counterAddShared(" + index + ")" : "counterAdd(" + index + ",1u)") + source.substr(close + 1);
+			countersUsed = true;
+			callLoc = findCall(source, call);
+		}
+	}
+	std::string counterDefinitions;
+	if (countersUsed) {
+		counterDefinitions = "layout(std430)buffer shaderCounters{uint counterData[];};"
+			"void counterAdd(uint index,uint amount){if(index<uint(counterData.length()))atomicAdd(counterData[index],amount);}";
+		const size_t mainLoc = findCall(source, "main");
+		if (sharedCounters && mainLoc != std::string::npos) {
+			unsigned sharedSize = 0;
+			for (unsigned counter : sharedOrder)
+				sharedSize += printf_detail::counters()[counter].bins;
+			counterDefinitions += "shared uint counterShared[" + std::to_string(sharedSize) + "];void counterAddShared(uint index){atomicAdd(counterShared[index],1u);}";
+
+			// the shader's own main runs between clearing and flushing the shared counters
+			source = source.substr(0, mainLoc) + "counterMain" + source.substr(mainLoc + 4);
+			source += "\nvoid main(){const uint counterThreads=gl_WorkGroupSize.x*gl_WorkGroupSize.y*gl_WorkGroupSize.z;"
+				"for(uint i=gl_LocalInvocationIndex;i<" + std::to_string(sharedSize) + "u;i+=counterThreads)counterShared[i]=0u;"
+				"memoryBarrierShared();barrier();counterMain();memoryBarrierShared();barrier();";
+			unsigned offset = 0;
+			for (unsigned counter : sharedOrder) {
+				const printf_detail::Counter& entry = printf_detail::counters()[counter];
+				source += "for(uint i=gl_LocalInvocationIndex;i<" + std::to_string(entry.bins) + "u;i+=counterThreads)"
+					"if(counterShared[" + std::to_string(offset) + "u+i]!=0u)counterAdd(" + std::to_string(entry.offset) + "u+i,counterShared[" + std::to_string(offset) + "u+i]);";
+				offset += entry.bins;
+			}
+			source += "}\n";
+		}
+	}
+
 	// go through all printfs in the shader
 	size_t printfLoc = findCall(source, "printf");
 	while (printfLoc != std::string::npos) {
@@ -261,15 +1180,13 @@ inline std::string addPrintToSource(std::string source) {
 			}
 		}
 
-		// come up with a list of data insertions that match the printf call
-		std::string replacement = "";
-		size_t argumentIndex = 0, writeSize = 0;
+		// gather the (unescaped) format string; adjacent literals are concatenated
+		std::string format = "";
 		inString = false;
 		for (size_t i = printfLoc; i < printfEndLoc; ++i) {
-
 			if (source[i] == '"')
 				inString = !inString;
-			if (inString && source[i] == '\\') {
+			else if (inString && source[i] == '\\') {
 				char ch = '\\';
 				switch (source[i + 1]) {
 				case '\'': ch = '\''; break;
@@ -285,58 +1202,69 @@ inline std::string addPrintToSource(std::string source) {
 				case 'v': ch = '\v'; break;
 				default: ch = ' ';
 				}
-				replacement += "printfData[printfIndex++]=" + std::to_string(ch) + ";";
-				writeSize++;
+				format += ch;
 				i++;
 			}
-			else if (inString && source[i] != '"') {
-				replacement += "printfData[printfIndex++]=" + std::to_string(unsigned(source[i])) + ";";
+			else if (inString)
+				format += source[i];
+		}
+
+		// the format string and location stay on the host; the shader writes the index of the site, the invocation and the values
+		const unsigned formatIndex = printf_detail::internFormat(format);
+		printf_detail::Site site;
+		site.format = formatIndex;
+		site.file = file;
+		site.line = printf_detail::lineOf(source, printfLoc);
+		site.stage = stage;
+		site.shader = shader;
+		const unsigned siteIndex = printf_detail::allocateSites(1);
+		printf_detail::sites()[siteIndex] = site;
+		std::string replacement = "uvec3 printfInvocation=" + std::string(printf_detail::invocationId(stage)) + ";"
+			"printfData[printfIndex++&printfWrap]=" + std::to_string(siteIndex) + "u;"
+			"printfData[printfIndex++&printfWrap]=printfInvocation.x;printfData[printfIndex++&printfWrap]=printfInvocation.y;printfData[printfIndex++&printfWrap]=printfInvocation.z;";
+		size_t argumentIndex = 0, writeSize = printf_detail::recordHeaderSize;
+		for (const printf_detail::Segment& segment : printf_detail::formats()[formatIndex].segments) {
+			if (segment.vecSize == 0)
+				continue;
+			std::string arg = argumentIndex < args.size() ? args[argumentIndex] : "0";
+			for (int j = 0; j < segment.vecSize; ++j) {
+				std::string component = arg;
+				if (segment.vecSize > 1)
+					component = "(" + arg + ")." + std::string("xyzw")[j];
+				switch (segment.spec.conversion) {
+				case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'x': case 'X':
+					replacement += "printfData[printfIndex++&printfWrap]=floatBitsToUint(" + component + ");"; break;
+				default:
+					replacement += "printfData[printfIndex++&printfWrap]=" + component + ";"; break;
+				}
 				writeSize++;
 			}
-			if (inString && source[i] == '%')
-				if (source[i + 1] == '%') {
-					i++;
-					replacement += "printfData[printfIndex++]=" + std::to_string(unsigned(source[i])) + ";";
-					writeSize++;
-				}
-				else {
-					int vecSize = 1;
-					while (std::string(1, source[i]).find_first_of("eEfFgGdiuoxXaA") == std::string::npos) {
-						// a special feature to support vector prints
-						if (source[i] == '^')
-							vecSize = source[i + 1] - '0';
-						i++;
-						replacement += "printfData[printfIndex++]=" + std::to_string(unsigned(source[i])) + ";";
-						writeSize++;
-					}
-					// store the actual data in the element after the format string
-					for (int j = 0; j < vecSize; ++j) {
-						std::string arg = args[argumentIndex];
-						if (vecSize > 1)
-							arg = "(" + arg + ")." + std::string("xyzw")[j];
-						switch (source[i]) {
-						case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'x': case 'X':
-							replacement += "printfData[printfIndex++]=floatBitsToUint(" + arg + ");"; break;
-						default:
-							replacement += "printfData[printfIndex++]=" + arg + ";"; break;
-						}
-						writeSize++;
-					}
-					argumentIndex++;
-				}
+			argumentIndex++;
 		}
 
-		source = source.substr(0, printfLoc) + "if(printfWriter){" + "uint printfIndex=min(atomicAdd(printfLocation," + std::to_string(writeSize) + "u),printfData.length()-" + std::to_string(writeSize) + "u);" + replacement + "}" + source.substr(printfEndLoc + 1);
+		source = source.substr(0, printfLoc) + "if(printfWriter){" + "uint printfIndex=printfAlloc(" + std::to_string(writeSize) + "u);if(printfIndex!=0xFFFFFFFFu){uint printfWrap=printfMask;" + replacement + "}}" + source.substr(printfEndLoc + 1);
 
 		printfLoc = findCall(source, "printf");
 	}
 
 	// insert the ssbo definition and some helper functions after the #version line
-	return source.substr(0, bufferInsertOffset) + "\nlayout(std430)buffer printfBuffer{uint printfLocation;uint printfData[];};bool printfWriter = false;void enablePrintf(){printfWriter=true;}void disablePrintf(){printfWriter=false;}\n#line " + std::to_string(lineAfterVersion) + "\n" + source.substr(bufferInsertOffset);
+	return source.substr(0, bufferInsertOffset) + printfDefinitions(subgroupAggregation && version != std::string::npos, stage) + counterDefinitions + "bool printfWriter = false;void enablePrintf(){printfWriter=true;}void disablePrintf(){printfWriter=false;}\n#line " + std::to_string(lineAfterVersion) + "\n" + source.substr(bufferInsertOffset);
 }
 
-// replacement for glShaderSource that parses printf commands into buffer insertions
-inline void glShaderSourcePrint(GLuint shader, GLsizei count, const GLchar **string, const GLint *length) {
+// frees the printf sites of a shader that isn't part of a linked program, such as one that failed to compile
+inline void releasePrintfShader(GLuint shader) {
+	printf_detail::releaseSites([&](const printf_detail::Site& site) { return site.shader == shader && site.program == 0; });
+}
+
+// frees the printf sites of a program and its shaders; call when deleting it
+inline void releasePrintfProgram(GLuint program) {
+	if (program == 0)
+		return;
+	printf_detail::releaseSites([&](const printf_detail::Site& site) { return site.program == program; });
+}
+
+// replacement for glShaderSource that parses printf commands into buffer insertions; file is used when reporting where records came from
+inline void glShaderSourcePrint(GLuint shader, GLsizei count, const GLchar **string, const GLint *length, const std::string& file = "") {
 	// first combine all of the potential source files to a single string
 	std::string source;
 	for (int i = 0; i < count; ++i) {
@@ -345,9 +1273,33 @@ inline void glShaderSourcePrint(GLuint shader, GLsizei count, const GLchar **str
 		else
 			source += std::string(string[i], length[i]);
 	}
-	// parse
-	source = addPrintToSource(source);
+	// parse; fragment shaders keep the plain atomics since helper invocations take part in subgroup operations but can't do atomics
+	GLint type;
+	glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+	// sites of whatever source this shader object had before go; those a linked program still runs stay with it until it's relinked or deleted
+	releasePrintfShader(shader);
+	for (printf_detail::Site& site : printf_detail::sites())
+		if (site.shader == shader)
+			site.shader = 0;
+	source = addPrintToSource(source, GLenum(type), file, shader, printfSubgroupAggregation() && type != GL_FRAGMENT_SHADER);
 	// do the compilation
 	auto* finalString = source.c_str();
 	glShaderSource(shader, 1, &finalString, nullptr);
+}
+
+// records which program the printf sites of the shaders attached to it belong to; call after linking
+inline void tagPrintfProgram(GLuint program) {
+	GLint count = 0;
+	glGetProgramiv(program, GL_ATTACHED_SHADERS, &count);
+	std::vector<GLuint> shaders(count > 0 ? count : 0);
+	if (count > 0)
+		glGetAttachedShaders(program, count, nullptr, shaders.data());
+	// a relink drops the shaders that were detached since the last one
+	printf_detail::releaseSites([&](const printf_detail::Site& site) {
+		return site.program == program && std::find(shaders.begin(), shaders.end(), site.shader) == shaders.end();
+	});
+	for (printf_detail::Site& site : printf_detail::sites())
+		for (GLuint shader : shaders)
+			if (site.shader == shader)
+				site.program = program;
 }
\ No newline at end of file
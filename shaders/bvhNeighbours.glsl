@@ -0,0 +1,191 @@
+#version 450
+
+// nearest neighbour and fixed radius queries over a point BVH in naive_bvh's layout, one thread per query. at an inner node the
+// nearer child is visited right away and the farther one goes on a short stack, to be skipped when it comes off if the search radius
+// (the k-th nearest so far, or the fixed radius) has shrunk past it. a full stack drops its bottom entry; those are always far
+// children hanging off the current path from the root, so once the stack runs dry the traversal walks up buildParents from where it
+// is, recomputing which child was the near one, and carries on from the first far child still in range.
+// a dispatch takes at most roundSteps steps per query (a point, a node, a stack entry or a level of the walk up); a query that
+// isn't done by then saves where it was to traversals and is carried on by the next dispatch with resume set. llvmpipe gives a
+// shader 65535 loop iterations in all and quietly cuts it off past that, which a wide radius search gets to easily
+
+layout(local_size_x = 64) in;
+
+layout(std430) buffer; // set as default
+
+buffer points { float pos[]; }; // all x, then all y, then all z
+buffer queries { float query[]; }; // the same layout
+buffer buildExtents { uvec2 ext[]; };
+buffer buildIndices { int alloc, children[]; };
+buffer buildSizes { int size[]; };
+buffer buildParents { int parent[]; };
+buffer indices { int index[]; };
+
+buffer neighbours { int neighbour[]; }; // k per query, nearest first, -1 past the last one found
+buffer distances { float distance[]; }; // likewise, infinity past the last one
+buffer neighbourCounts { uint neighbourCount[]; }; // per query: found, or with countAll every point within radius
+buffer traversals { int traversal[]; }; // per query: the state below, then the stack and its distances
+buffer unfinished { uint unfinishedCount; }; // queries left for another dispatch
+
+uniform uint pointCount, queryCount, k;
+uniform float radius;
+uniform bool countAll, resume;
+
+const int maxK = 32;
+const int stackSize = 16;
+const int roundSteps = 4096; // well within llvmpipe's limit even when the insertions of all lanes in a batch add up
+const int stateSize = 9 + 2 * stackSize;
+const int finished = -2; // in place of node
+
+float unsortable(uint x) {
+	return uintBitsToFloat(x ^ (((x>>31)-1)|0x80000000));
+}
+
+// squared distance from q to the box of node; precise so that the walk up makes the same near/far choices as the way down
+float boxDistance(int node, vec3 q) {
+	precise vec3 d;
+	for (int a = 0; a < 3; ++a) {
+		const uvec2 b = ext[node * 3 + a];
+		d[a] = max(max(unsortable(b.x) - q[a], q[a] - unsortable(b.y)), .0);
+	}
+	precise float result = dot(d, d);
+	return result;
+}
+
+void main() {
+	const uint i = gl_GlobalInvocationID.x;
+	if (i >= queryCount) return;
+	const int state = int(i) * stateSize;
+	if (resume && traversal[state] == finished) return;
+	const vec3 q = vec3(query[i], query[i + queryCount], query[i + 2u * queryCount]);
+	const float infinity = uintBitsToFloat(0x7f800000u), range = radius * radius;
+
+	// the best so far, squared distances ascending; between dispatches they wait in neighbours and distances
+	float bestDistance[maxK];
+	int best[maxK];
+	for (uint j = 0u; j < k; ++j) {
+		bestDistance[j] = resume ? distance[i * k + j] : infinity;
+		best[j] = resume ? neighbour[i * k + j] : -1;
+	}
+	const int lastSlot = int(k) - 1; // an int index; llvmpipe misreads the array at k - 1u
+
+	int stack[stackSize];
+	float stackDistance[stackSize];
+	for (int j = 0; j < stackSize; ++j) {
+		stack[j] = resume ? traversal[state + 9 + j] : 0;
+		stackDistance[j] = resume ? intBitsToFloat(traversal[state + 9 + stackSize + j]) : infinity;
+	}
+
+	int node = boxDistance(0, q) <= range ? 0 : -1, last = 0;
+	int next = 0, end = 0; // the points of the leaf being scanned
+	int top = 0, depth = 0; // a ring, so that a full stack can drop its bottom
+	bool dropped = false;
+	uint found = 0u;
+	float bound = range; // nodes farther than this can't contribute
+	if (resume) {
+		node = traversal[state];
+		last = traversal[state + 1];
+		next = traversal[state + 2];
+		end = traversal[state + 3];
+		top = traversal[state + 4];
+		depth = traversal[state + 5];
+		dropped = traversal[state + 6] != 0;
+		found = uint(traversal[state + 7]);
+		bound = intBitsToFloat(traversal[state + 8]);
+	}
+
+	// one step per iteration rather than loops in loops, as the iterations of inner loops that diverge across a SIMD batch add up
+	bool done = false;
+	for (int step = 0; step < roundSteps && !done; ++step) {
+		if (next < end) {
+			const int p = index[next++];
+			const vec3 d = vec3(pos[p], pos[p + pointCount], pos[p + 2u * pointCount]) - q;
+			const float d2 = dot(d, d);
+			if (d2 > range) continue;
+			if (countAll) ++found;
+			if (d2 >= bestDistance[lastSlot]) continue;
+			if (!countAll) found = min(found + 1u, k);
+			int slot = lastSlot;
+			for (; slot > 0 && bestDistance[slot - 1] > d2; --slot) {
+				bestDistance[slot] = bestDistance[slot - 1];
+				best[slot] = best[slot - 1];
+			}
+			bestDistance[slot] = d2;
+			best[slot] = p;
+			if (!countAll)
+				bound = min(range, bestDistance[lastSlot]);
+		}
+		else if (node >= 0) {
+			last = node;
+			if (size[node] > 0) {
+				next = children[node];
+				end = next + size[node];
+				node = -1;
+			}
+			else {
+				const int first = children[node];
+				const float d0 = boxDistance(first, q), d1 = boxDistance(first + 1, q);
+				const int near = d1 < d0 ? first + 1 : first;
+				const float nearDistance = min(d0, d1), farDistance = max(d0, d1);
+				if (farDistance <= bound) {
+					if (depth == stackSize)
+						dropped = true;
+					else
+						++depth;
+					stack[top] = 2 * first + 1 - near;
+					stackDistance[top] = farDistance;
+					top = (top + 1) % stackSize;
+				}
+				node = nearDistance <= bound ? near : -1;
+			}
+		}
+		else if (depth > 0) {
+			top = (top + stackSize - 1) % stackSize;
+			--depth;
+			if (stackDistance[top] <= bound)
+				node = stack[top];
+			else
+				last = stack[top];
+		}
+		else if (dropped && parent[last] >= 0) {
+			// a level of the walk up: the sibling, if last was the near child and the far one is in range
+			const int first = children[parent[last]];
+			const float d0 = boxDistance(first, q), d1 = boxDistance(first + 1, q);
+			const int near = d1 < d0 ? first + 1 : first;
+			if (last == near && max(d0, d1) <= bound)
+				node = 2 * first + 1 - near;
+			last = parent[last];
+		}
+		else
+			done = true;
+	}
+
+	if (!done) {
+		traversal[state] = node;
+		traversal[state + 1] = last;
+		traversal[state + 2] = next;
+		traversal[state + 3] = end;
+		traversal[state + 4] = top;
+		traversal[state + 5] = depth;
+		traversal[state + 6] = int(dropped);
+		traversal[state + 7] = int(found);
+		traversal[state + 8] = floatBitsToInt(bound);
+		for (int j = 0; j < stackSize; ++j) {
+			traversal[state + 9 + j] = stack[j];
+			traversal[state + 9 + stackSize + j] = floatBitsToInt(stackDistance[j]);
+		}
+		for (uint j = 0u; j < k; ++j) {
+			neighbour[i * k + j] = best[j];
+			distance[i * k + j] = bestDistance[j];
+		}
+		atomicAdd(unfinishedCount, 1u);
+		return;
+	}
+
+	traversal[state] = finished;
+	for (uint j = 0u; j < k; ++j) {
+		neighbour[i * k + j] = best[j];
+		distance[i * k + j] = best[j] >= 0 ? sqrt(bestDistance[j]) : infinity;
+	}
+	neighbourCount[i] = found;
+}
@@ -0,0 +1,61 @@
+#version 450
+
+// how good a point BVH in naive_bvh's layout is, reduced per workgroup into bvhPartials for the host to add up: the SAH cost with
+// unit costs (like sahCost() in bvh.h, except that nodes with a size count as leaves) and the overlap, the surface area of the
+// intersection of every pair of siblings. both relative to the root's surface area
+
+layout(local_size_x = 1024) in;
+
+layout(std430) buffer; // set as default
+
+buffer buildExtents { uvec2 ext[]; };
+buffer buildIndices { int alloc, children[]; };
+buffer buildSizes { int size[]; };
+buffer buildParents { int parent[]; };
+buffer bvhPartials { vec2 partial[]; }; // (cost, overlap) per workgroup
+
+float unsortable(uint x) {
+	return uintBitsToFloat(x ^ (((x>>31)-1)|0x80000000));
+}
+
+// surface area of the box of node, or of its intersection with other's; 0 for an empty box
+float area(int node, int other) {
+	vec3 size;
+	for (int a = 0; a < 3; ++a) {
+		uvec2 bounds = ext[node * 3 + a];
+		if (other >= 0) {
+			const uvec2 b = ext[other * 3 + a];
+			bounds = uvec2(max(bounds.x, b.x), min(bounds.y, b.y));
+		}
+		if (bounds.x > bounds.y) return .0;
+		size[a] = unsortable(bounds.y) - unsortable(bounds.x);
+	}
+	return 2. * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+shared vec2 sums[1024];
+
+void main() {
+	const int i = int(gl_GlobalInvocationID.x);
+	const uint t = gl_LocalInvocationID.x;
+	vec2 sum = vec2(.0);
+	if (i < alloc && (i == 0 || parent[i] >= 0)) {
+		const float root = area(0, -1), scale = root > .0 ? 1. / root : .0;
+		if (size[i] > 0)
+			sum.x = float(size[i]) * area(i, -1) * scale;
+		else {
+			const int first = children[i];
+			if (first > 0 && first < alloc && parent[first] == i) // not an empty leaf
+				sum = vec2(area(i, -1), area(first, first + 1)) * scale;
+		}
+	}
+	sums[t] = sum;
+	barrier();
+	for (uint stride = 512u; stride > 0u; stride >>= 1) {
+		if (t < stride)
+			sums[t] += sums[t + stride];
+		barrier();
+	}
+	if (t == 0u)
+		partial[gl_WorkGroupID.x] = sums[0];
+}
@@ -0,0 +1,66 @@
+#version 450
+
+// refits any point BVH in naive_bvh's layout to moved points: the topology stays and every box is recomputed from the bottom up.
+// every point grows its leaf's box (cleared to empty beforehand) and the last one to arrive at the leaf, counted against its size,
+// carries on up the parents: the first thread to arrive at an inner node stops there, the second unions the two children and goes on.
+// with emptyLeaves, one thread per node instead starts the climb from the leaves no point arrives at (naive_bvh's split can leave
+// those behind), so that their parents still see two arrivals
+
+layout(local_size_x = 1024) in;
+
+layout(std430) buffer; // set as default
+
+buffer points { float pos[]; }; // all x, then all y, then all z
+buffer extents { float halfSize[]; }; // same layout, only read with hasExtents
+buffer nodes { int treeNode[]; };
+buffer bvhArrivals { uint arrived[]; }; // per node, zeroed before the first dispatch
+
+coherent buffer buildExtents { uvec2 ext[]; };
+buffer buildIndices { int alloc, children[]; };
+buffer buildSizes { int size[]; };
+buffer buildParents { int parent[]; };
+
+uniform uint count; // points
+uniform bool hasExtents;
+uniform bool emptyLeaves;
+
+uint sortable(float x) {
+	return floatBitsToUint(x) ^ uint((-int(floatBitsToUint(x)>>31))|0x80000000);
+}
+
+// node is done: fit the inner nodes above it whose other child is done too
+void climb(int node) {
+	for (int inner = parent[node]; inner >= 0; inner = parent[inner]) {
+		memoryBarrierBuffer();
+		if (atomicAdd(arrived[inner], 1u) == 0u) return;
+		const int first = children[inner];
+		for (int a = 0; a < 3; ++a) {
+			const uvec2 l = ext[first * 3 + a], r = ext[(first + 1) * 3 + a];
+			ext[inner * 3 + a] = uvec2(min(l.x, r.x), max(l.y, r.y));
+		}
+	}
+}
+
+void main() {
+	const int i = int(gl_GlobalInvocationID.x);
+	if (emptyLeaves) {
+		// a leaf without points under an inner node; nodes without a parent other than the root are unused
+		if (i == 0 || i >= alloc || size[i] != 0) return;
+		const int up = parent[i];
+		if (up < 0 || size[up] != 0) return;
+		const int first = children[i];
+		if (first > 0 && first < alloc && parent[first] == i) return; // an inner node
+		climb(i);
+	}
+	else if (i < int(count)) {
+		const int leaf = treeNode[i];
+		for (uint a = 0u; a < 3u; ++a) {
+			const float p = pos[i + a * count], e = hasExtents ? halfSize[i + a * count] : .0;
+			atomicMin(ext[leaf * 3 + int(a)].x, sortable(p - e));
+			atomicMax(ext[leaf * 3 + int(a)].y, sortable(p + e));
+		}
+		memoryBarrierBuffer();
+		if (atomicAdd(arrived[leaf], 1u) + 1u == uint(size[leaf]))
+			climb(leaf);
+	}
+}
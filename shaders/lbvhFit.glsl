@@ -0,0 +1,63 @@
+#version 450
+
+// one thread per leaf of the linear BVH: writes the leaf, then walks up the parents. the first thread to reach an inner node stops
+// there, the second knows both children are done and bounds the node; so every node is written exactly once, from the bottom up,
+// without any pass per level. the output is laid out like naive_bvh's tree, with one point per leaf
+
+layout(local_size_x = 1024) in;
+
+layout(std430) buffer; // set as default
+
+buffer points { float pos[]; }; // all x, then all y, then all z
+buffer extents { float halfSize[]; }; // same layout, only read with hasExtents
+buffer indices { int index[]; }; // sorted by morton code
+buffer nodes { int treeNode[]; };
+buffer lbvhLinks { ivec2 link[]; };
+buffer lbvhArrivals { uint arrived[]; }; // per inner node, zeroed before the dispatch
+
+coherent buffer buildExtents { uvec2 ext[]; };
+buffer buildIndices { int alloc, children[]; };
+buffer buildSizes { int size[]; };
+buffer buildParents { int parent[]; };
+
+uniform uint count;
+uniform bool hasExtents;
+
+uint sortable(float x) {
+	return floatBitsToUint(x) ^ uint((-int(floatBitsToUint(x)>>31))|0x80000000);
+}
+
+void main() {
+	const uint k = gl_GlobalInvocationID.x;
+	if (k >= count) return;
+	if (k == 0u)
+		alloc = 2 * int(count) - 1;
+
+	const int point = index[k];
+	ivec2 here = count == 1u ? ivec2(-1, 0) : link[count - 1u + k];
+	int node = here.y;
+	for (uint a = 0u; a < 3u; ++a) {
+		const float p = pos[point + a * count], e = hasExtents ? halfSize[point + a * count] : .0;
+		ext[node * 3 + int(a)] = uvec2(sortable(p - e), sortable(p + e));
+	}
+	children[node] = int(k);
+	size[node] = 1;
+	parent[node] = here.x < 0 ? -1 : link[here.x].y;
+	treeNode[point] = node;
+
+	// sortable bounds compare as uints, so the union is a plain min and max
+	for (int inner = here.x; inner >= 0; inner = here.x) {
+		memoryBarrierBuffer();
+		if (atomicAdd(arrived[inner], 1u) == 0u) return;
+		here = link[inner];
+		node = here.y;
+		const int first = 1 + 2 * inner;
+		for (int a = 0; a < 3; ++a) {
+			const uvec2 l = ext[first * 3 + a], r = ext[(first + 1) * 3 + a];
+			ext[node * 3 + a] = uvec2(min(l.x, r.x), max(l.y, r.y));
+		}
+		children[node] = first;
+		size[node] = 0;
+		parent[node] = here.x < 0 ? -1 : link[here.x].y;
+	}
+}
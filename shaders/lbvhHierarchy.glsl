@@ -0,0 +1,60 @@
+#version 450
+
+// one thread per inner node of the binary radix tree over the sorted morton codes (Karras, "Maximizing parallelism in the
+// construction of BVHs, octrees, and k-d trees"): inner node i covers a range of keys that starts or ends at key i, and splits it
+// where the highest differing bit changes. equal codes are told apart by their position, so duplicates are fine.
+// lbvhLinks gets, per node of the radix tree (inner nodes 0..count-2, then the leaves), its parent and its place in the output: the
+// children of inner node i go to nodes 1 + 2i and 2 + 2i, so siblings are adjacent like naive_bvh's, and the root is node 0
+
+layout(local_size_x = 1024) in;
+
+layout(std430) buffer; // set as default
+
+buffer keysIn { uvec2 key[]; }; // sorted
+buffer lbvhLinks { ivec2 link[]; }; // (parent inner node or -1, output node)
+
+uniform uint count;
+
+// length of the common prefix of keys i and j, -1 if j is out of range
+int delta(int i, int j) {
+	if (j < 0 || j >= int(count)) return -1;
+	const uvec2 x = key[i] ^ key[j];
+	if (x.y != 0u) return 31 - findMSB(x.y);
+	if (x.x != 0u) return 63 - findMSB(x.x);
+	return 95 - findMSB(uint(i ^ j));
+}
+
+void main() {
+	const int i = int(gl_GlobalInvocationID.x);
+	if (i >= int(count) - 1) return;
+
+	// the range goes towards the neighbour with the longer common prefix
+	const int d = delta(i, i + 1) > delta(i, i - 1) ? 1 : -1;
+	const int deltaMin = delta(i, i - d);
+	int lengthMax = 2;
+	while (delta(i, i + lengthMax * d) > deltaMin)
+		lengthMax *= 2;
+	int l = 0;
+	for (int t = lengthMax / 2; t > 0; t /= 2)
+		if (delta(i, i + (l + t) * d) > deltaMin)
+			l += t;
+	const int j = i + l * d;
+
+	// binary search for the split
+	const int deltaNode = delta(i, j);
+	int s = 0, t = l;
+	do {
+		t = (t + 1) / 2;
+		if (delta(i, i + (s + t) * d) > deltaNode)
+			s += t;
+	} while (t > 1);
+	const int split = i + s * d + min(d, 0);
+
+	const int leaves = int(count) - 1;
+	const int left = min(i, j) == split ? leaves + split : split;
+	const int right = max(i, j) == split + 1 ? leaves + split + 1 : split + 1;
+	link[left] = ivec2(i, 1 + 2 * i);
+	link[right] = ivec2(i, 2 + 2 * i);
+	if (i == 0)
+		link[0] = ivec2(-1, 0);
+}
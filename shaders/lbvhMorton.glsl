@@ -0,0 +1,89 @@
+#version 450
+
+// morton codes for the linear BVH builder. with bounds set, each workgroup reduces its points' box in shared memory and merges it
+// into lbvhBox with one atomic per axis and side; otherwise every point gets the code of where it lies in that box: 10 bits per axis
+// (30 in total) or with wideCodes 21 per axis (63), as a uvec2 of low and high word, and its own index as the value to sort
+
+layout(local_size_x = 1024) in;
+
+layout(std430) buffer; // set as default
+
+buffer points { float pos[]; }; // all x, then all y, then all z
+buffer lbvhBox { uvec2 box[3]; }; // (min, max) per axis through sortable()
+buffer keysOut { uvec2 keyOut[]; };
+buffer valuesOut { uint valueOut[]; };
+
+uniform uint count;
+uniform bool bounds;
+uniform bool wideCodes;
+
+uint sortable(float x) {
+	return floatBitsToUint(x) ^ uint((-int(floatBitsToUint(x)>>31))|0x80000000);
+}
+float unsortable(uint x) {
+	return uintBitsToFloat(x ^ (((x>>31)-1)|0x80000000));
+}
+
+// spreads the low 10 bits of x two bits apart
+uint spread(uint x) {
+	x = (x | (x << 16)) & 0x030000ffu;
+	x = (x | (x << 8)) & 0x0300f00fu;
+	x = (x | (x << 4)) & 0x030c30c3u;
+	x = (x | (x << 2)) & 0x09249249u;
+	return x;
+}
+
+shared vec3 low[1024], high[1024];
+
+void main() {
+	const uint i = gl_GlobalInvocationID.x, t = gl_LocalInvocationID.x;
+	vec3 p = vec3(.0);
+	if (i < count)
+		p = vec3(pos[i], pos[i + count], pos[i + 2u * count]);
+
+	if (bounds) {
+		const float huge = uintBitsToFloat(0x7f800000u);
+		low[t] = i < count ? p : vec3(huge);
+		high[t] = i < count ? p : vec3(-huge);
+		barrier();
+		for (uint stride = 512u; stride > 0u; stride >>= 1) {
+			if (t < stride) {
+				low[t] = min(low[t], low[t + stride]);
+				high[t] = max(high[t], high[t + stride]);
+			}
+			barrier();
+		}
+		if (t < 3u && gl_WorkGroupID.x * 1024u < count) {
+			atomicMin(box[t].x, sortable(low[0][t]));
+			atomicMax(box[t].y, sortable(high[0][t]));
+		}
+	}
+	else if (i < count) {
+		vec3 from, size;
+		for (int a = 0; a < 3; ++a) {
+			from[a] = unsortable(box[a].x);
+			size[a] = unsortable(box[a].y) - from[a];
+		}
+		const vec3 f = clamp((p - from) / max(size, vec3(1e-30)), vec3(.0), vec3(1.));
+		uvec2 code = uvec2(0u);
+		if (wideCodes) {
+			const uvec3 q = min(uvec3(f * 2097152.), uvec3(2097151u));
+			// bit b of axis a lands on bit 3b + 2 - a of the code
+			for (uint b = 0u; b < 21u; ++b)
+				for (uint a = 0u; a < 3u; ++a) {
+					const uint bit = 3u * b + 2u - a;
+					const uint set = (q[a] >> b) & 1u;
+					if (bit < 32u)
+						code.x |= set << bit;
+					else
+						code.y |= set << (bit - 32u);
+				}
+		}
+		else {
+			const uvec3 q = min(uvec3(f * 1024.), uvec3(1023u));
+			code.x = (spread(q.x) << 2) | (spread(q.y) << 1) | spread(q.z);
+		}
+		keyOut[i] = code;
+		valueOut[i] = i;
+	}
+}
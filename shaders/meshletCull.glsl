@@ -0,0 +1,51 @@
+#version 450
+
+// one thread per meshlet: frustum and normal cone tests, survivors appended to a compacted list of draw commands.
+// baseInstance carries the meshlet's material, like Mesh::drawCommands
+
+layout(local_size_x = 64) in;
+
+layout(std430) buffer; // set as default
+
+struct Meshlet {
+	vec4 sphere; // center, radius
+	vec4 cone; // axis, cutoff
+	uint firstIndex, indexCount, material, padding;
+};
+
+// DrawElementsIndirectCommand
+struct DrawCommand {
+	uint count, instanceCount, firstIndex;
+	int baseVertex;
+	uint baseInstance;
+};
+
+buffer meshlets { Meshlet meshlet[]; };
+buffer commands { DrawCommand command[]; };
+buffer drawCount { uint visibleCount; };
+
+uniform mat4 toClip;
+uniform vec3 eye;
+uniform uint meshletCount;
+
+void main() {
+	const uint i = gl_GlobalInvocationID.x;
+	if (i >= meshletCount) return;
+	const Meshlet m = meshlet[i];
+	const vec3 center = m.sphere.xyz;
+	const float radius = m.sphere.w;
+
+	// frustum planes straight from the matrix rows (Gribb & Hartmann); the sphere has to be fully outside one of them
+	const mat4 rows = transpose(toClip);
+	const vec4 planes[6] = vec4[6](rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1], rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2]);
+	for (int p = 0; p < 6; ++p)
+		if (dot(planes[p].xyz, center) + planes[p].w < -radius * length(planes[p].xyz))
+			return;
+
+	// every triangle faces away from the eye
+	const vec3 view = center - eye;
+	if (dot(view, m.cone.xyz) >= m.cone.w * length(view) + radius)
+		return;
+
+	command[atomicAdd(visibleCount, 1u)] = DrawCommand(m.indexCount, 1u, m.firstIndex, 0, m.material);
+}
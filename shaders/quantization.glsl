@@ -0,0 +1,31 @@
+// decoding of the vertex streams of a Mesh loaded with VertexFormat::quantized (see quantizeVertices() in mesh_optimizer.h).
+// #include "quantization.glsl" from a shader in this directory, and read vertices with meshPosition/meshNormal/meshUv(gl_VertexID)
+
+layout(std430) buffer quantizedPositions { uvec2 quantizedPosition[]; };	// 16-bit fractions of the box: x | y << 16, z
+layout(std430) buffer quantizedNormals { uint quantizedNormal[]; };		// octahedral, 2 x snorm16
+layout(std430) buffer quantizedUvs { uint quantizedUv[]; };				// 2 x unorm16 fractions of the uv box
+layout(std430) buffer quantization {
+	vec4 positionLow, positionExtent;
+	vec4 uvBox; // low in xy, extent in zw
+};
+
+vec3 decodePosition(uvec2 q, vec3 low, vec3 extent) {
+	return low + vec3(unpackUnorm2x16(q.x), unpackUnorm2x16(q.y).x) * extent;
+}
+
+// the octahedron folded out onto a square; the lower half is mirrored into the corners
+vec3 decodeOctahedral(uint q) {
+	const vec2 e = unpackSnorm2x16(q);
+	vec3 n = vec3(e, 1. - abs(e.x) - abs(e.y));
+	const float fold = max(-n.z, 0.);
+	n.xy += vec2(n.x >= 0. ? -fold : fold, n.y >= 0. ? -fold : fold);
+	return normalize(n);
+}
+
+vec2 decodeUv(uint q, vec4 box) {
+	return box.xy + unpackUnorm2x16(q) * box.zw;
+}
+
+vec4 meshPosition(uint vertex) { return vec4(decodePosition(quantizedPosition[vertex], positionLow.xyz, positionExtent.xyz), 1.); }
+vec3 meshNormal(uint vertex) { return decodeOctahedral(quantizedNormal[vertex]); }
+vec2 meshUv(uint vertex) { return decodeUv(quantizedUv[vertex], uvBox); }
@@ -0,0 +1,82 @@
+#version 450
+
+// one 4-bit digit of an LSD radix sort of 64-bit keys (uvec2: low word, high word) with a uint value each, in tiles of 1024 keys,
+// 4 consecutive ones per thread. the host runs it twice per digit: first the tiles count their digits into digitCounts (digit-major,
+// so an exclusive scan of it gives every tile where its run of each digit goes), then after the scan they scatter. keys keep their
+// order within a digit, which is what makes the next digit's pass stable
+
+layout(local_size_x = 256) in;
+
+layout(std430) buffer; // set as default
+
+buffer keysIn { uvec2 keyIn[]; };
+buffer valuesIn { uint valueIn[]; };
+buffer keysOut { uvec2 keyOut[]; };
+buffer valuesOut { uint valueOut[]; };
+buffer digitCounts { uint digitCount[]; };
+
+uniform uint count;
+uniform uint pass; // bits 4*pass .. 4*pass+3 of the key
+uniform bool scatter;
+
+shared uint histogram[16];
+// per thread 16 counters of 16 bits, two to a uint; [word * 256 + thread]
+shared uint counted[8 * 256];
+
+void main() {
+	const uint t = gl_LocalInvocationID.x, first = gl_WorkGroupID.x * 1024u + 4u * t;
+	const uint tiles = gl_NumWorkGroups.x, tile = gl_WorkGroupID.x;
+
+	uvec2 keys[4];
+	uint digits[4];
+	for (uint e = 0u; e < 4u; ++e) {
+		keys[e] = first + e < count ? keyIn[first + e] : uvec2(0u);
+		digits[e] = ((pass < 8u ? keys[e].x : keys[e].y) >> (4u * (pass & 7u))) & 15u;
+	}
+
+	if (!scatter) {
+		if (t < 16u)
+			histogram[t] = 0u;
+		barrier();
+		for (uint e = 0u; e < 4u; ++e)
+			if (first + e < count)
+				atomicAdd(histogram[digits[e]], 1u);
+		barrier();
+		if (t < 16u)
+			digitCount[t * tiles + tile] = histogram[t];
+	}
+	else {
+		// how many of each digit this thread has, then an exclusive scan of that over the threads (Hillis-Steele, inclusive minus
+		// own): the keys of each digit in the threads before this one
+		uint counters[8];
+		for (uint w = 0u; w < 8u; ++w)
+			counters[w] = 0u;
+		for (uint e = 0u; e < 4u; ++e)
+			if (first + e < count)
+				counters[digits[e] >> 1] += 1u << (16u * (digits[e] & 1u));
+		const uint own[8] = counters;
+		for (uint w = 0u; w < 8u; ++w)
+			counted[w * 256u + t] = counters[w];
+		barrier();
+		for (uint offset = 1u; offset < 256u; offset <<= 1) {
+			uint previous[8];
+			for (uint w = 0u; w < 8u; ++w)
+				previous[w] = t >= offset ? counted[w * 256u + t - offset] : 0u;
+			barrier();
+			for (uint w = 0u; w < 8u; ++w)
+				counted[w * 256u + t] = counters[w] += previous[w];
+			barrier();
+		}
+		for (uint w = 0u; w < 8u; ++w)
+			counters[w] -= own[w];
+
+		for (uint e = 0u; e < 4u; ++e)
+			if (first + e < count) {
+				const uint d = digits[e], shift = 16u * (d & 1u);
+				const uint target = digitCount[d * tiles + tile] + ((counters[d >> 1] >> shift) & 0xffffu);
+				counters[d >> 1] += 1u << shift;
+				keyOut[target] = keys[e];
+				valueOut[target] = valueIn[first + e];
+			}
+	}
+}
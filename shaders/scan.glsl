@@ -0,0 +1,41 @@
+#version 450
+
+// exclusive prefix sums in blocks of 256: each block is scanned on its own and its total goes to scanSums. the host scans the totals
+// the same way, level by level until one block is left, then runs the levels back down with addSums to offset every block by the
+// sum of the blocks before it
+
+layout(local_size_x = 256) in;
+
+layout(std430) buffer; // set as default
+
+buffer scanData { uint data[]; };
+buffer scanSums { uint sums[]; };
+
+uniform uint count;
+uniform bool addSums;
+
+shared uint partial[256];
+
+void main() {
+	const uint i = gl_GlobalInvocationID.x, t = gl_LocalInvocationID.x;
+	if (addSums) {
+		if (i < count)
+			data[i] += sums[gl_WorkGroupID.x];
+	}
+	else {
+		const uint value = i < count ? data[i] : 0u;
+		partial[t] = value;
+		barrier();
+		// Hillis-Steele: after the step with offset o, partial[t] sums the 2o values up to t
+		for (uint offset = 1u; offset < 256u; offset <<= 1) {
+			const uint previous = t >= offset ? partial[t - offset] : 0u;
+			barrier();
+			partial[t] += previous;
+			barrier();
+		}
+		if (i < count)
+			data[i] = partial[t] - value;
+		if (t == 255u)
+			sums[gl_WorkGroupID.x] = partial[t];
+	}
+}
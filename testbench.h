@@ -5,8 +5,17 @@
 #include "window.h"
 #include "shaderprintf.h"
 #include "gl_helpers.h"
+#include "image_loader.h"
+#include "texture_cache.h"
+#include "obj_loader.h"
+#include "mesh_optimizer.h"
+#include "mesh.h"
+#include "bvh.h"
+#include "gpu_bvh.h"
 #include "math_helpers.h"
 #include "gl_timing.h"
 #include "math.hpp"
+#ifdef _WIN32
 #include "text_renderer.h"
+#endif
 #include "inline_glsl.h"
@@ -25,8 +25,8 @@ void main() {
 		}
 		res = (opponent * res - truth);
 		float cur = dot(vec3(1.), abs(res));
-		//if(!isnan(cur) && !isinf(cur))
-			adder[gl_LocalInvocationID.x] += cur;
+		checkFinite(cur);
+		adder[gl_LocalInvocationID.x] += cur;
 	}
 	for(int i = int(gl_WorkGroupSize.x)/2; i>0; i /= 2) {
 		barrier();
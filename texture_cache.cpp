@@ -0,0 +1,528 @@
+
+#include "texture_cache.h"
+#include "mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+
+namespace {
+
+	// bump when the encoders change so old cache entries stop matching
+	const uint64_t encoderVersion = 1;
+
+	const int weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	// blocks are filled least significant bit first
+	struct BlockWriter {
+		uint64_t bits[2] = { 0, 0 };
+		int position = 0;
+		void put(uint32_t value, int count) {
+			for (int i = 0; i < count; ++i, ++position)
+				if ((value >> i) & 1) bits[position >> 6] |= uint64_t(1) << (position & 63);
+		}
+		void write(uint8_t* out) const { memcpy(out, bits, 16); }
+	};
+
+	// dominant direction of the block's colors by power iteration; falls back to the diagonal for flat blocks
+	template<int channels>
+	void principalAxis(const float (*points)[4], const float* mean, float* axis) {
+		float covariance[channels][channels] = {};
+		for (int i = 0; i < 16; ++i)
+			for (int a = 0; a < channels; ++a)
+				for (int b = 0; b < channels; ++b)
+					covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+		for (int a = 0; a < channels; ++a) axis[a] = 1.f;
+		for (int iteration = 0; iteration < 8; ++iteration) {
+			float next[channels] = {}, length = 0.f;
+			for (int a = 0; a < channels; ++a) {
+				for (int b = 0; b < channels; ++b) next[a] += covariance[a][b] * axis[b];
+				length += next[a] * next[a];
+			}
+			if (length < 1e-12f) return;
+			length = 1.f / sqrtf(length);
+			for (int a = 0; a < channels; ++a) axis[a] = next[a] * length;
+		}
+	}
+
+	// endpoints at the extent of the points along the axis
+	template<int channels>
+	void fitLine(const float (*points)[4], float (*endpoints)[4]) {
+		float mean[4] = {}, axis[4] = {};
+		for (int i = 0; i < 16; ++i)
+			for (int a = 0; a < channels; ++a) mean[a] += points[i][a] / 16.f;
+		principalAxis<channels>(points, mean, axis);
+		float low = 1e30f, high = -1e30f;
+		for (int i = 0; i < 16; ++i) {
+			float t = 0.f;
+			for (int a = 0; a < channels; ++a) t += (points[i][a] - mean[a]) * axis[a];
+			low = t < low ? t : low; high = t > high ? t : high;
+		}
+		for (int a = 0; a < channels; ++a) {
+			endpoints[0][a] = mean[a] + low * axis[a];
+			endpoints[1][a] = mean[a] + high * axis[a];
+		}
+	}
+
+	// least squares endpoints for fixed interpolation weights; leaves them alone if all points use the same weight
+	template<int channels>
+	void refineLine(const float (*points)[4], const int* indices, float (*endpoints)[4]) {
+		float aa = 0.f, ab = 0.f, bb = 0.f, ap[4] = {}, bp[4] = {};
+		for (int i = 0; i < 16; ++i) {
+			const float t = weights4[indices[i]] / 64.f, s = 1.f - t;
+			aa += s * s; ab += s * t; bb += t * t;
+			for (int a = 0; a < channels; ++a) { ap[a] += s * points[i][a]; bp[a] += t * points[i][a]; }
+		}
+		const float determinant = aa * bb - ab * ab;
+		if (fabsf(determinant) < 1e-6f) return;
+		for (int a = 0; a < channels; ++a) {
+			endpoints[0][a] = (ap[a] * bb - bp[a] * ab) / determinant;
+			endpoints[1][a] = (bp[a] * aa - ap[a] * ab) / determinant;
+		}
+	}
+
+	// ---- bc7, mode 6 only: one subset, rgba 7.7.7.7 endpoints with a p-bit each, 4-bit indices ----
+
+	void encodeBc7(const uint8_t (*texels)[4], uint8_t* out) {
+		float points[16][4];
+		bool opaque = true;
+		for (int i = 0; i < 16; ++i) {
+			for (int c = 0; c < 4; ++c) points[i][c] = texels[i][c];
+			opaque = opaque && texels[i][3] == 255;
+		}
+		float endpoints[2][4];
+		fitLine<4>(points, endpoints);
+
+		int bestError = INT32_MAX, bestQuantized[2][4] = {}, bestPbits[2] = {}, bestIndices[16] = {};
+		for (int pass = 0; pass < 3; ++pass) {
+			// an opaque block must decode to exactly 255, which needs both p-bits set
+			for (int pbits = opaque ? 3 : 0; pbits < 4; ++pbits) {
+				const int p[2] = { pbits & 1, pbits >> 1 };
+				int quantized[2][4], values[2][4];
+				for (int e = 0; e < 2; ++e)
+					for (int c = 0; c < 4; ++c) {
+						const int q = int((endpoints[e][c] - p[e]) * .5f + .5f);
+						quantized[e][c] = q < 0 ? 0 : q > 127 ? 127 : q;
+						values[e][c] = quantized[e][c] * 2 + p[e];
+					}
+				int palette[16][4];
+				for (int i = 0; i < 16; ++i)
+					for (int c = 0; c < 4; ++c)
+						palette[i][c] = ((64 - weights4[i]) * values[0][c] + weights4[i] * values[1][c] + 32) >> 6;
+				int error = 0, indices[16];
+				for (int i = 0; i < 16; ++i) {
+					int best = INT32_MAX;
+					for (int k = 0; k < 16; ++k) {
+						int e = 0;
+						for (int c = 0; c < 4; ++c) {
+							const int d = palette[k][c] - texels[i][c];
+							e += d * d;
+						}
+						if (e < best) { best = e; indices[i] = k; }
+					}
+					error += best;
+				}
+				if (error < bestError) {
+					bestError = error;
+					memcpy(bestQuantized, quantized, sizeof(quantized));
+					bestPbits[0] = p[0]; bestPbits[1] = p[1];
+					memcpy(bestIndices, indices, sizeof(indices));
+				}
+			}
+			if (bestError == 0) break;
+			refineLine<4>(points, bestIndices, endpoints);
+		}
+
+		// the first index is stored without its top bit, so it has to be below 8
+		if (bestIndices[0] >= 8) {
+			for (int c = 0; c < 4; ++c) std::swap(bestQuantized[0][c], bestQuantized[1][c]);
+			std::swap(bestPbits[0], bestPbits[1]);
+			for (int& index : bestIndices) index = 15 - index;
+		}
+		BlockWriter block;
+		block.put(1 << 6, 7);
+		for (int c = 0; c < 4; ++c) {
+			block.put(bestQuantized[0][c], 7);
+			block.put(bestQuantized[1][c], 7);
+		}
+		block.put(bestPbits[0], 1);
+		block.put(bestPbits[1], 1);
+		for (int i = 0; i < 16; ++i)
+			block.put(bestIndices[i], i == 0 ? 3 : 4);
+		block.write(out);
+	}
+
+	// ---- bc5: two independent bc4 channels ----
+
+	void encodeBc4(const uint8_t* values, int stride, uint8_t* out) {
+		int low = 255, high = 0;
+		for (int i = 0; i < 16; ++i) {
+			low = values[i * stride] < low ? values[i * stride] : low;
+			high = values[i * stride] > high ? values[i * stride] : high;
+		}
+		// red0 > red1 selects the 8 level mode; codes 0 and 1 are the endpoints, 2..7 step from red0 towards red1
+		out[0] = uint8_t(high); out[1] = uint8_t(low);
+		float palette[8] = { float(high), float(low) };
+		for (int k = 2; k < 8; ++k) palette[k] = ((8 - k) * high + (k - 1) * low) / 7.f;
+		uint64_t codes = 0;
+		for (int i = 0; i < 16 && high > low; ++i) {
+			int best = 0;
+			float bestError = 1e30f;
+			for (int k = 0; k < 8; ++k) {
+				const float e = fabsf(palette[k] - values[i * stride]);
+				if (e < bestError) { bestError = e; best = k; }
+			}
+			codes |= uint64_t(best) << (3 * i);
+		}
+		for (int i = 0; i < 6; ++i) out[2 + i] = uint8_t(codes >> (8 * i));
+	}
+
+	void encodeBc5(const uint8_t (*texels)[4], uint8_t* out) {
+		encodeBc4(&texels[0][0], 4, out);
+		encodeBc4(&texels[0][1], 4, out + 8);
+	}
+
+	// ---- bc6h (unsigned), mode 11 only: one region, untransformed 10-bit endpoints, 4-bit indices ----
+
+	uint16_t toHalf(float value) {
+		if (!(value > 0.f)) return 0; // negatives and nan; the unsigned format can't hold them
+		if (value >= 65504.f) return 0x7BFF;
+		int exponent;
+		const float mantissa = frexpf(value, &exponent); // value = mantissa * 2^exponent, mantissa in [.5, 1)
+		if (exponent < -13) // denormal
+			return uint16_t(value * 16777216.f + .5f);
+		const int bits = int((mantissa * 2.f - 1.f) * 1024.f + .5f) + ((exponent + 14) << 10);
+		return uint16_t(bits > 0x7BFF ? 0x7BFF : bits);
+	}
+
+	int unquantize10(int value) {
+		return value == 0 ? 0 : value == 1023 ? 0xFFFF : ((value << 16) + 0x8000) >> 10;
+	}
+
+	int quantize10(float value) {
+		int best = int(value / 64.f);
+		best = best < 0 ? 0 : best > 1023 ? 1023 : best;
+		for (int candidate = best - 1; candidate <= best + 1; candidate += 2)
+			if (candidate >= 0 && candidate <= 1023 && fabsf(unquantize10(candidate) - value) < fabsf(unquantize10(best) - value))
+				best = candidate;
+		return best;
+	}
+
+	void encodeBc6h(const float (*texels)[3], uint8_t* out) {
+		// the format interpolates in a space where half floats are just integers; endpoints are fit there
+		int halves[16][3];
+		float points[16][4];
+		for (int i = 0; i < 16; ++i)
+			for (int c = 0; c < 3; ++c) {
+				halves[i][c] = toHalf(texels[i][c]);
+				points[i][c] = halves[i][c] * 64.f / 31.f;
+			}
+		float endpoints[2][4];
+		fitLine<3>(points, endpoints);
+
+		int64_t bestError = INT64_MAX;
+		int bestQuantized[2][3] = {}, bestIndices[16] = {};
+		for (int pass = 0; pass < 3; ++pass) {
+			int quantized[2][3], palette[16][3];
+			for (int e = 0; e < 2; ++e)
+				for (int c = 0; c < 3; ++c)
+					quantized[e][c] = quantize10(endpoints[e][c]);
+			for (int k = 0; k < 16; ++k)
+				for (int c = 0; c < 3; ++c)
+					palette[k][c] = (((64 - weights4[k]) * unquantize10(quantized[0][c]) + weights4[k] * unquantize10(quantized[1][c]) + 32) >> 6) * 31 >> 6;
+			int64_t error = 0;
+			int indices[16];
+			for (int i = 0; i < 16; ++i) {
+				int64_t best = INT64_MAX;
+				for (int k = 0; k < 16; ++k) {
+					int64_t e = 0;
+					for (int c = 0; c < 3; ++c) {
+						const int64_t d = palette[k][c] - halves[i][c];
+						e += d * d;
+					}
+					if (e < best) { best = e; indices[i] = k; }
+				}
+				error += best;
+			}
+			if (error < bestError) {
+				bestError = error;
+				memcpy(bestQuantized, quantized, sizeof(quantized));
+				memcpy(bestIndices, indices, sizeof(indices));
+			}
+			if (bestError == 0) break;
+			refineLine<3>(points, bestIndices, endpoints);
+		}
+
+		if (bestIndices[0] >= 8) {
+			for (int c = 0; c < 3; ++c) std::swap(bestQuantized[0][c], bestQuantized[1][c]);
+			for (int& index : bestIndices) index = 15 - index;
+		}
+		BlockWriter block;
+		block.put(3, 5);
+		for (int e = 0; e < 2; ++e)
+			for (int c = 0; c < 3; ++c)
+				block.put(bestQuantized[e][c], 10);
+		for (int i = 0; i < 16; ++i)
+			block.put(bestIndices[i], i == 0 ? 3 : 4);
+		block.write(out);
+	}
+
+	// ---- ktx2 ----
+
+	const uint8_t ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	// vulkan format numbers, as KTX2 uses them
+	enum : uint32_t { vkBc5Unorm = 141, vkBc6hUfloat = 143, vkBc7Unorm = 145, vkBc7Srgb = 146 };
+
+	GLenum glFormat(uint32_t vkFormat) {
+		switch (vkFormat) {
+		case vkBc5Unorm: return GL_COMPRESSED_RG_RGTC2;
+		case vkBc6hUfloat: return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+		case vkBc7Unorm: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+		case vkBc7Srgb: return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+		default: return 0;
+		}
+	}
+
+	void put32(std::vector<uint8_t>& out, uint32_t value) { for (int i = 0; i < 4; ++i) out.push_back(uint8_t(value >> (8 * i))); }
+	void put64(std::vector<uint8_t>& out, uint64_t value) { for (int i = 0; i < 8; ++i) out.push_back(uint8_t(value >> (8 * i))); }
+	void set64(std::vector<uint8_t>& out, size_t at, uint64_t value) { for (int i = 0; i < 8; ++i) out[at + i] = uint8_t(value >> (8 * i)); }
+	uint32_t get32(const uint8_t* p) { return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24); }
+	uint64_t get64(const uint8_t* p) { return uint64_t(get32(p)) | (uint64_t(get32(p + 4)) << 32); }
+
+	// basic data format descriptor: one 4x4 block of 16 bytes, a sample per stored channel
+	void putDescriptor(std::vector<uint8_t>& out, uint32_t vkFormat) {
+		const int samples = vkFormat == vkBc5Unorm ? 2 : 1;
+		const uint32_t blockSize = 24 + 16 * samples;
+		const uint32_t model = vkFormat == vkBc5Unorm ? 132 : vkFormat == vkBc6hUfloat ? 133 : 134;
+		const uint32_t transfer = vkFormat == vkBc7Srgb ? 2 : 1;
+		put32(out, 4 + blockSize);
+		put32(out, 0);							// khronos, basic descriptor
+		put32(out, 2 | (blockSize << 16));		// version 2
+		put32(out, model | (1 << 8) | (transfer << 16));	// bt.709 primaries
+		put32(out, 3 | (3 << 8));				// 4x4 texels (stored minus one)
+		put32(out, 16); put32(out, 0);			// bytes in plane 0
+		for (int s = 0; s < samples; ++s) {
+			const uint32_t flags = vkFormat == vkBc6hUfloat ? 0x80 : 0; // float
+			put32(out, uint32_t(64 * s) | (uint32_t(128 / samples - 1) << 16) | ((uint32_t(s) | flags) << 24));
+			put32(out, 0);
+			put32(out, 0);
+			put32(out, vkFormat == vkBc6hUfloat ? 0x3F800000 : 0xFFFFFFFF);
+		}
+	}
+
+	bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+		std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+		if (!file) return false;
+		file.seekg(0, std::ios::end);
+		data.resize(size_t(file.tellg()));
+		file.seekg(0);
+		return bool(file.read((char*)data.data(), data.size()));
+	}
+}
+
+std::vector<uint8_t> encodeKtx2(ImageData image, BlockFormat format) {
+	if (!image) return {};
+	if (format == BlockFormat::automatic)
+		format = image.hdr ? BlockFormat::bc6h : BlockFormat::bc7;
+	if ((format == BlockFormat::bc6h) != image.hdr) {
+		printf("encodeKtx2: bc6h is for hdr images only, and hdr images can only go to bc6h\n");
+		return {};
+	}
+	if (format == BlockFormat::bc5) image.linear = true;
+	if (image.levels.size() <= 1)
+		generateMips(image);
+	const uint32_t vkFormat = format == BlockFormat::bc5 ? vkBc5Unorm : format == BlockFormat::bc6h ? vkBc6hUfloat : (image.linear ? vkBc7Unorm : vkBc7Srgb);
+	const int levels = int(image.levels.size());
+
+	// encode every level; blocks are independent, so rows of blocks are spread over all cores
+	std::vector<std::vector<uint8_t>> encoded(levels);
+	unsigned threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	for (int level = 0; level < levels; ++level) {
+		const int width = image.width >> level ? image.width >> level : 1, height = image.height >> level ? image.height >> level : 1;
+		const int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+		encoded[level].resize(size_t(blocksX) * blocksY * 16);
+		const uint8_t* texels = image.texels.data() + image.levels[level];
+		std::atomic<int> nextRow{ 0 };
+		auto work = [&] {
+			for (int by; (by = nextRow++) < blocksY;)
+				for (int bx = 0; bx < blocksX; ++bx) {
+					uint8_t* out = encoded[level].data() + (size_t(by) * blocksX + bx) * 16;
+					// edge blocks repeat the last row and column
+					if (image.hdr) {
+						float block[16][3];
+						for (int i = 0; i < 16; ++i) {
+							const int x = bx * 4 + (i & 3) < width ? bx * 4 + (i & 3) : width - 1, y = by * 4 + (i >> 2) < height ? by * 4 + (i >> 2) : height - 1;
+							memcpy(block[i], (const float*)texels + (size_t(y) * width + x) * 3, sizeof(block[i]));
+						}
+						encodeBc6h(block, out);
+						continue;
+					}
+					uint8_t block[16][4];
+					for (int i = 0; i < 16; ++i) {
+						const int x = bx * 4 + (i & 3) < width ? bx * 4 + (i & 3) : width - 1, y = by * 4 + (i >> 2) < height ? by * 4 + (i >> 2) : height - 1;
+						const uint8_t* texel = texels + (size_t(y) * width + x) * image.channels;
+						for (int c = 0; c < 4; ++c) block[i][c] = c < image.channels ? texel[c] : 255;
+					}
+					if (format == BlockFormat::bc5) encodeBc5(block, out);
+					else encodeBc7(block, out);
+				}
+		};
+		std::vector<std::thread> workers;
+		for (unsigned i = 1; i < threads && blocksY > 1; ++i)
+			workers.emplace_back(work);
+		work();
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	std::vector<uint8_t> out(ktx2Identifier, ktx2Identifier + 12);
+	put32(out, vkFormat);
+	put32(out, 1);								// type size, 1 for block compressed
+	put32(out, image.width); put32(out, image.height);
+	put32(out, 0); put32(out, 0); put32(out, 1);	// depth, layers, faces
+	put32(out, levels);
+	put32(out, 0);								// no supercompression
+	const size_t indexAt = out.size();
+	for (int i = 0; i < 4; ++i) put32(out, 0);
+	put64(out, 0); put64(out, 0);				// no supercompression global data
+	const size_t levelIndexAt = out.size();
+	out.resize(out.size() + 24 * size_t(levels));
+
+	const size_t descriptorAt = out.size();
+	putDescriptor(out, vkFormat);
+	const size_t keyValueAt = out.size();
+	static const char writer[] = "KTXwriter\0glsl testbench";
+	put32(out, sizeof(writer));
+	out.insert(out.end(), writer, writer + sizeof(writer));
+	while (out.size() % 4) out.push_back(0);
+	const size_t keyValueEnd = out.size();
+	for (size_t i = 0; i < 4; ++i) {
+		const uint32_t values[4] = { uint32_t(descriptorAt), uint32_t(keyValueAt - descriptorAt), uint32_t(keyValueAt), uint32_t(keyValueEnd - keyValueAt) };
+		for (int b = 0; b < 4; ++b) out[indexAt + i * 4 + b] = uint8_t(values[i] >> (8 * b));
+	}
+
+	// level data goes smallest first, each aligned to the block size
+	for (int level = levels - 1; level >= 0; --level) {
+		while (out.size() % 16) out.push_back(0);
+		set64(out, levelIndexAt + 24 * level, out.size());
+		set64(out, levelIndexAt + 24 * level + 8, encoded[level].size());
+		set64(out, levelIndexAt + 24 * level + 16, encoded[level].size());
+		out.insert(out.end(), encoded[level].begin(), encoded[level].end());
+	}
+	return out;
+}
+
+namespace {
+	// path is just for the messages
+	Texture<GL_TEXTURE_2D> loadKtx2(std::istream& file, const std::string& path) {
+		uint8_t header[80];
+		if (!file.read((char*)header, sizeof(header)) || memcmp(header, ktx2Identifier, 12)) {
+			printf("loadKtx2: %s isn't a KTX2 file\n", path.c_str());
+			return Texture<GL_TEXTURE_2D>(0u);
+		}
+		const uint32_t vkFormat = get32(header + 12), width = get32(header + 20), height = get32(header + 24);
+		const uint32_t depth = get32(header + 28), layers = get32(header + 32), faces = get32(header + 36), levels = get32(header + 40), supercompression = get32(header + 44);
+		const GLenum internalFormat = glFormat(vkFormat);
+		if (!internalFormat || depth > 1 || layers > 1 || faces != 1 || supercompression != 0 || width == 0 || height == 0 || levels == 0 || levels > 32) {
+			printf("loadKtx2: %s is not a plain 2D bc5/bc6h/bc7 texture\n", path.c_str());
+			return Texture<GL_TEXTURE_2D>(0u);
+		}
+		std::vector<uint8_t> levelIndex(24 * size_t(levels));
+		file.read((char*)levelIndex.data(), levelIndex.size());
+		file.seekg(0, std::ios::end);
+		const uint64_t fileSize = uint64_t(file.tellg());
+		uint64_t dataStart = fileSize, dataEnd = 0;
+		for (uint32_t level = 0; level < levels; ++level) {
+			const uint64_t offset = get64(&levelIndex[24 * level]), length = get64(&levelIndex[24 * level + 8]);
+			const uint64_t w = width >> level ? width >> level : 1, h = height >> level ? height >> level : 1;
+			if (length != (w + 3) / 4 * ((h + 3) / 4) * 16 || offset + length > fileSize) {
+				printf("loadKtx2: %s has a broken level index\n", path.c_str());
+				return Texture<GL_TEXTURE_2D>(0u);
+			}
+			dataStart = offset < dataStart ? offset : dataStart;
+			dataEnd = offset + length > dataEnd ? offset + length : dataEnd;
+		}
+
+		// the blocks go from the file straight into a PBO; nothing on the CPU looks at them
+		GLuint staging;
+		glCreateBuffers(1, &staging);
+		glNamedBufferStorage(staging, dataEnd - dataStart, nullptr, GL_MAP_WRITE_BIT);
+		void* mapped = glMapNamedBufferRange(staging, 0, dataEnd - dataStart, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		file.seekg(dataStart);
+		const bool complete = bool(file.read((char*)mapped, dataEnd - dataStart));
+		glUnmapNamedBuffer(staging);
+		if (!complete) {
+			glDeleteBuffers(1, &staging);
+			printf("loadKtx2: couldn't read %s\n", path.c_str());
+			return Texture<GL_TEXTURE_2D>(0u);
+		}
+
+		Texture<GL_TEXTURE_2D> result;
+		glTextureStorage2D(result, levels, internalFormat, width, height);
+		GLint unpackBuffer;
+		glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging);
+		for (uint32_t level = 0; level < levels; ++level) {
+			const uint64_t offset = get64(&levelIndex[24 * level]), length = get64(&levelIndex[24 * level + 8]);
+			glCompressedTextureSubImage2D(result, level, 0, 0, width >> level ? width >> level : 1, height >> level ? height >> level : 1, internalFormat, GLsizei(length), (const void*)(offset - dataStart));
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+		glDeleteBuffers(1, &staging);
+		return result;
+	}
+}
+
+Texture<GL_TEXTURE_2D> loadKtx2(const std::string& path) {
+	std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+	return loadKtx2(file, path);
+}
+
+Texture<GL_TEXTURE_2D> loadCompressedImage(const std::string& path, BlockFormat format, const std::string& cacheDirectory) {
+	std::vector<uint8_t> source;
+	if (!readFile(path, source)) {
+		printf("loadCompressedImage: couldn't open %s\n", path.c_str());
+		return Texture<GL_TEXTURE_2D>(0u);
+	}
+	// resolved up front so both spellings of the same encoding share a cache entry (radiance files start with #?)
+	if (format == BlockFormat::automatic)
+		format = source.size() >= 2 && source[0] == '#' && source[1] == '?' ? BlockFormat::bc6h : BlockFormat::bc7;
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.ktx2", (unsigned long long)hashBytes(source.data(), source.size(), encoderVersion * 16 + uint64_t(format)));
+	const std::filesystem::path cached = std::filesystem::u8path(cacheDirectory) / name;
+
+	std::error_code ec;
+	if (std::filesystem::exists(cached, ec)) {
+		auto result = loadKtx2(cached.u8string());
+		if (result) return result;
+	}
+
+	const auto encoded = encodeKtx2(decodeImage(source.data(), source.size()), format);
+	if (encoded.empty()) {
+		printf("loadCompressedImage: (while reading %s)\n", path.c_str());
+		return Texture<GL_TEXTURE_2D>(0u);
+	}
+	// written under a temporary name first, so a concurrent run never sees half a file
+	std::filesystem::create_directories(cached.parent_path(), ec);
+	std::filesystem::path temporary = cached;
+	temporary += ".partial" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+	{
+		std::ofstream file(temporary, std::ios::binary);
+		file.write((const char*)encoded.data(), encoded.size());
+	}
+	std::filesystem::rename(temporary, cached, ec);
+	if (ec) {
+		printf("loadCompressedImage: couldn't write %s to the cache\n", path.c_str());
+		std::filesystem::remove(temporary, ec);
+		std::istringstream memory(std::string(encoded.begin(), encoded.end()));
+		return loadKtx2(memory, path);
+	}
+	return loadKtx2(cached.u8string());
+}
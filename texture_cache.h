@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "gl_helpers.h"
+#include "image_loader.h"
+
+// block compressed textures and an on-disk cache of them: the first load of an image decodes, builds mips and encodes them,
+// then writes a KTX2 file; later loads just read that file into a PBO and hand the blocks to the GL as they are.
+
+enum class BlockFormat {
+	automatic,	// bc6h for hdr images, bc7 for everything else
+	bc7,		// rgba8 (sRGB), 1 byte per texel
+	bc5,		// two linear channels (red, green) for normal maps and such, 1 byte per texel
+	bc6h		// rgb half floats, 1 byte per texel
+};
+
+// mips are generated when the image has none; bc5 treats the data as linear
+std::vector<uint8_t> encodeKtx2(ImageData image, BlockFormat format);
+
+// uploads a KTX2 file written by encodeKtx2 (bc5/bc6h/bc7, 2D, no supercompression); returns an empty texture on failure
+Texture<GL_TEXTURE_2D> loadKtx2(const std::string& path);
+
+// the cache key is a hash of the source file and the format, so edited sources get re-encoded and stale entries are simply never hit
+Texture<GL_TEXTURE_2D> loadCompressedImage(const std::string& path, BlockFormat format = BlockFormat::automatic, const std::string& cacheDirectory = "texture_cache");
@@ -38,14 +38,15 @@ void setTitle(const std::string& title) {
 	SetWindowTextA(wnd, title.c_str());
 }
 
-POINT getMouse() {
+MousePosition getMouse() {
 	POINT mouse;
 	GetCursorPos(&mouse);
 	ScreenToClient(wnd, &mouse);
-	return mouse;
+	return MousePosition{ int(mouse.x), int(mouse.y) };
 }
 
-void setMouse(POINT p) {
+void setMouse(MousePosition position) {
+	POINT p = { position.x, position.y };
 	ClientToScreen(wnd, &p);
 	SetCursorPos(p.x, p.y);
 }
@@ -53,14 +54,14 @@ void setMouse(POINT p) {
 WPARAM down[256]; int downptr = 0;
 WPARAM hit[256]; int hitptr = 0;
 
-bool keyDown(UINT vk_code) {
+bool keyDown(unsigned vk_code) {
 	for (int i = 0; i < downptr; ++i)
 		if (vk_code == down[i])
 			return true;
 	return false;
 }
 
-bool keyHit(UINT vk_code) {
+bool keyHit(unsigned vk_code) {
 	for (int i = 0; i < hitptr; ++i)
 		if (vk_code == hit[i])
 			return true;
@@ -1,14 +1,16 @@
 
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <string>
 #include <fstream>
 
-#include <gl/gl.h>
-#include "loadgl/glext.h"
-#include "loadgl/wglext.h"
 #include "loadgl/loadgl46.h"
+#ifdef _WIN32
+#include "loadgl/wglext.h"
+#endif
 
 void setupGL(int width, int height, const std::string& title, bool fullscreen, bool show);
 void closeGL();
@@ -19,12 +21,15 @@ void setTitle(const std::string& title);
 void showWindow();
 void hideWindow();
 
-bool keyDown(UINT vk_code);
-bool keyHit(UINT vk_code);
+// key codes are win32 virtual-key codes; a headless context never gets any input
+bool keyDown(unsigned vk_code);
+bool keyHit(unsigned vk_code);
 void resetHits();
 
-POINT getMouse();
-void setMouse(POINT);
+// in client coordinates
+struct MousePosition { int x, y; };
+MousePosition getMouse();
+void setMouse(MousePosition);
 
 // todo: make this a true class? or use some kind of "finally" for the close?
 // possible reasoning: don't really want singleton, but don't really want to support multiple contexts either
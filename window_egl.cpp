@@ -0,0 +1,216 @@
+
+// headless backend for everything in window.h: an EGL context without a display server (mesa surfaceless, or any EGL with pbuffers)
+// build this instead of window.cpp on linux; there is no window, so the input functions never report anything
+#include "window.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+
+const EGLint EGL_CONFIG_ATTRIBUTES[] = {
+	EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+	EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+
+	EGL_RED_SIZE, 8,
+	EGL_GREEN_SIZE, 8,
+	EGL_BLUE_SIZE, 8,
+	EGL_ALPHA_SIZE, 8,
+	EGL_DEPTH_SIZE, 24,
+EGL_NONE };
+
+// same version as the wgl path; software rasterizers tend to stop at 4.5 so that's tried second
+const EGLint GL_CONTEXT_VERSIONS[][2] = { { 4, 6 }, { 4, 5 } };
+
+EGLDisplay display = EGL_NO_DISPLAY;
+EGLSurface surface = EGL_NO_SURFACE;
+EGLContext context = EGL_NO_CONTEXT;
+
+// the pbuffer (if any) is never shown, but swapping keeps frame-based code paths identical
+void swapBuffers() {
+	if (surface != EGL_NO_SURFACE)
+		eglSwapBuffers(display, surface);
+}
+
+void setTitle(const std::string&) {}
+
+MousePosition getMouse() {
+	return MousePosition{ 0, 0 };
+}
+
+void setMouse(MousePosition) {}
+
+bool keyDown(unsigned) {
+	return false;
+}
+
+bool keyHit(unsigned) {
+	return false;
+}
+
+void resetHits() {}
+
+// nothing can close a window that doesn't exist, so the loop runs until the program decides otherwise
+bool loop() {
+	return glOpen();
+}
+
+void APIENTRY glDebugCallback(GLenum source, GLenum type, GLuint id, GLenum, GLsizei length, const GLchar * message, const void *) {
+
+	auto output = std::string("OpenGL ");
+
+	switch (type) {
+	case GL_DEBUG_TYPE_ERROR:					output += "error";							break;
+	case GL_DEBUG_TYPE_PORTABILITY:				output += "portability issue";				break;
+	case GL_DEBUG_TYPE_PERFORMANCE:				output += "performance issue";				break;
+	case GL_DEBUG_TYPE_OTHER:					output += "issue";							break;
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:		output += "undefined behavior";				break;
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:		output += "deprecated behavior";			break;
+	default:									output += "issue(?)";						break;
+	}
+	switch (source) {
+	case GL_DEBUG_SOURCE_API:																break;
+	case GL_DEBUG_SOURCE_WINDOW_SYSTEM:			output += " in the window system";			break;
+	case GL_DEBUG_SOURCE_SHADER_COMPILER:		output += " in the shader compiler";		break;
+	case GL_DEBUG_SOURCE_THIRD_PARTY:			output += " in third party code";			break;
+	case GL_DEBUG_SOURCE_APPLICATION:			output += " in this program";				break;
+	case GL_DEBUG_SOURCE_OTHER:					output += " in an undefined source";		break;
+	default:									output += " nowhere(?)";					break;
+	}
+
+	output += ", id " + std::to_string(id) + ":\n";
+	output += std::string(message, length);
+
+	printf("%s\n", output.c_str());
+
+	// same idea as _CrtDbgBreak on windows, but only if someone is there to catch it: a debugger sets this variable
+	if (type == GL_DEBUG_TYPE_ERROR && getenv("GL_DEBUG_BREAK"))
+		raise(SIGTRAP);
+}
+
+bool hasExtension(const char* extensions, const char* name) {
+	const size_t length = strlen(name);
+	for (const char* found = extensions; extensions && (found = strstr(found, name)); found += length)
+		if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+			return true;
+	return false;
+}
+
+// prefer the surfaceless platform (no X/wayland/gbm needed at all), fall back to whatever the default display is
+EGLDisplay openDisplay() {
+	const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+		auto eglGetPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (eglGetPlatformDisplay) {
+			EGLDisplay result = eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			if (result != EGL_NO_DISPLAY && eglInitialize(result, nullptr, nullptr))
+				return result;
+		}
+	}
+	EGLDisplay result = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (result != EGL_NO_DISPLAY && eglInitialize(result, nullptr, nullptr))
+		return result;
+	return EGL_NO_DISPLAY;
+}
+
+GLuint vertexArray;
+
+void setupGL(int width, int height, const std::string&, bool, bool) {
+
+	if (glOpen()) return;
+
+	display = openDisplay();
+	if (display == EGL_NO_DISPLAY) {
+		printf("setupGL: couldn't initialize an EGL display\n");
+		return;
+	}
+	eglBindAPI(EGL_OPENGL_API);
+
+	// a pbuffer of the requested size stands in for the window's default framebuffer when the platform has them
+	EGLConfig config = nullptr;
+	EGLint configCount = 0;
+	eglChooseConfig(display, EGL_CONFIG_ATTRIBUTES, &config, 1, &configCount);
+	const bool surfaceless = hasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+	if (configCount > 0) {
+		const EGLint pbufferAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+		surface = eglCreatePbufferSurface(display, config, pbufferAttributes);
+	}
+	if (surface == EGL_NO_SURFACE && !surfaceless) {
+		printf("setupGL: EGL display has neither pbuffers nor surfaceless contexts\n");
+		eglTerminate(display);
+		display = EGL_NO_DISPLAY;
+		return;
+	}
+
+	for (auto& version : GL_CONTEXT_VERSIONS) {
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, version[0],
+			EGL_CONTEXT_MINOR_VERSION, version[1],
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			//EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+		EGL_NONE };
+		context = eglCreateContext(display, configCount > 0 ? config : EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+		if (context != EGL_NO_CONTEXT) break;
+	}
+	if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, surface, surface, context)) {
+		printf("setupGL: couldn't create an OpenGL 4.5+ core context\n");
+		closeGL();
+		return;
+	}
+	glViewport(0, 0, width, height);
+
+	// what GL did we get?
+	printf("gl  %s\non  %s\nby  %s\nsl  %s\n", glGetString(GL_VERSION), glGetString(GL_RENDERER), glGetString(GL_VENDOR), glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+	loadgl();
+
+	// enable debug output
+	glEnable(GL_DEBUG_OUTPUT);
+	// debug output from main thread: step-by-step debug from the correct stack frame when breaking
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+	glDebugMessageCallback((GLDEBUGPROC)glDebugCallback, 0);
+
+	// query everything about errors, deprecated and undefined things
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_ERROR, GL_DONT_CARE, 0, 0, GL_TRUE);
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR, GL_DONT_CARE, 0, 0, GL_TRUE);
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR, GL_DONT_CARE, 0, 0, GL_TRUE);
+
+	// disable misc info. might want to check these from time to time!
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_OTHER, GL_DONT_CARE, 0, 0, GL_FALSE);
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PERFORMANCE, GL_DONT_CARE, 0, 0, GL_FALSE);
+
+	// we won't be using VBOs so a single global VAO is plenty
+	glCreateVertexArrays(1, &vertexArray);
+	glBindVertexArray(vertexArray);
+
+	glEnable(GL_FRAMEBUFFER_SRGB);
+}
+
+void closeGL() {
+	if (display == EGL_NO_DISPLAY) return;
+
+	if (context != EGL_NO_CONTEXT && eglGetCurrentContext() == context) {
+		glBindVertexArray(0);
+		glDeleteVertexArrays(1, &vertexArray);
+	}
+
+	// release context, surface
+	eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+	if (surface != EGL_NO_SURFACE) eglDestroySurface(display, surface);
+	eglTerminate(display);
+	context = EGL_NO_CONTEXT;
+	surface = EGL_NO_SURFACE;
+	display = EGL_NO_DISPLAY;
+}
+
+bool glOpen() {
+	return context != EGL_NO_CONTEXT;
+}
+
+void showWindow() {}
+
+void hideWindow() {}